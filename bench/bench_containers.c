@@ -0,0 +1,583 @@
+/*
+ *      filename:       bench_containers.c
+ *      author:         @keiferchiang
+ *      date:           18 Oct 2026
+ *      version:        0.0.1
+ *
+ *      description:    Microbenchmarks for the container modules.
+ *                      Doubles as the training workload of the
+ *                      profile-guided build (make pgo)
+ *
+ *      usage:          bench_containers [scale [runs]]
+ *
+ *                      Prints one "<name> <ns/op>" line per benchmark.
+ *                      scale multiplies the number of repetitions and
+ *                      each benchmark is timed runs times, keeping the
+ *                      fastest run
+ */
+
+#define _POSIX_C_SOURCE 199309L
+
+#include <stdint.h>
+#include <time.h>
+
+#include "vector.h"
+#include "vector_sort.h"
+#include "topk.h"
+#include "vector_set.h"
+#include "dlinkedlist.h"
+#include "deque.h"
+
+/*-------------------------------------
+ * Representation
+ -------------------------------------*/
+typedef struct bench {
+        const char *name;
+        long (*run)(int reps);
+        int reps;
+} Bench_T;
+
+/*-------------------------------------
+ * Function Prototypes
+ -------------------------------------*/
+long bench_vector_append(int reps);
+long bench_vector_get(int reps);
+long bench_vector_iter(int reps);
+long bench_iter_pipeline(int reps);
+long bench_vector_prepend(int reps);
+long bench_vector_remove(int reps);
+long bench_vector_new_free(int reps);
+long bench_vector_new_free_cached(int reps);
+long bench_vector_radix_sort(int reps);
+long bench_topk(int reps);
+long bench_vector_intersect(int reps);
+long bench_deque_prepend(int reps);
+long bench_deque_get(int reps);
+long bench_dlist_append(int reps);
+long bench_dlist_prepend(int reps);
+long bench_dlist_get(int reps);
+long bench_dlist_iter(int reps);
+long bench_dlist_set(int reps);
+long bench_dlist_new_free(int reps);
+long bench_dlist_clear(int reps);
+void discard_batch(void **elems, int length, void *cl);
+int cmp_elem(void *a, void *b, void *cl);
+bool keep_even(void *elem, void *cl);
+void *double_elem(void *elem, void *cl);
+double elapsed_ns(const struct timespec *start);
+
+/*-------------------------------------
+ * Globals
+ -------------------------------------*/
+/* Keeps the compiler from discarding benchmark loops */
+volatile uintptr_t sink;
+
+/* Element stored by the insertion benchmarks */
+static int payload;
+
+static Bench_T benches[] = {
+        { "vector_append",      bench_vector_append,    40 },
+        { "vector_get",         bench_vector_get,       40 },
+        { "vector_iter",        bench_vector_iter,      40 },
+        { "iter_pipeline",      bench_iter_pipeline,    10 },
+        { "vector_prepend",     bench_vector_prepend,   4 },
+        { "vector_remove",      bench_vector_remove,    4 },
+        { "vector_new_free",    bench_vector_new_free,  20 },
+        { "vector_new_cached",  bench_vector_new_free_cached, 20 },
+        { "vector_radix_sort",  bench_vector_radix_sort, 10 },
+        { "topk",               bench_topk,             20 },
+        { "vector_intersect",   bench_vector_intersect, 20 },
+        { "deque_prepend",      bench_deque_prepend,    40 },
+        { "deque_get",          bench_deque_get,        40 },
+        { "dlist_append",       bench_dlist_append,     20 },
+        { "dlist_prepend",      bench_dlist_prepend,    20 },
+        { "dlist_get",          bench_dlist_get,        4 },
+        { "dlist_iter",         bench_dlist_iter,       400 },
+        { "dlist_set",          bench_dlist_set,        4 },
+        { "dlist_new_free",     bench_dlist_new_free,   20 },
+        { "dlist_clear",        bench_dlist_clear,      20 },
+};
+
+/*-------------------------------------
+ * Main
+ -------------------------------------*/
+int main(int argc, char *argv[])
+{
+        struct timespec start;
+        double ns, best;
+        long ops;
+        int scale = 1;
+        int runs = 1;
+        unsigned i;
+        int r;
+
+        if (argc > 1)
+                scale = atoi(argv[1]);
+        if (argc > 2)
+                runs = atoi(argv[2]);
+        if (scale < 1)
+                scale = 1;
+        if (runs < 1)
+                runs = 1;
+
+        /* the fastest run is the one least disturbed by the machine */
+        for (i = 0; i < sizeof(benches) / sizeof(benches[0]); i++) {
+                best = 0;
+                for (r = 0; r < runs; r++) {
+                        clock_gettime(CLOCK_MONOTONIC, &start);
+                        ops = benches[i].run(benches[i].reps * scale);
+                        ns = elapsed_ns(&start) / ops;
+                        if (r == 0 || ns < best)
+                                best = ns;
+                }
+                printf("%-20s %10.2f\n", benches[i].name, best);
+        }
+
+        return 0;
+}
+
+/*-------------------------------------
+ * Function Definitions
+ -------------------------------------*/
+long bench_vector_append(int reps)
+{
+        Vector_T vec;
+        int n = 1 << 16;
+        int r, i;
+
+        for (r = 0; r < reps; r++) {
+                vec = Vector_new(0);
+                for (i = 0; i < n; i++)
+                        Vector_append(vec, &payload);
+                sink += Vector_length(vec);
+                Vector_free(&vec);
+        }
+
+        return (long) reps * n;
+}
+
+long bench_vector_get(int reps)
+{
+        Vector_T vec;
+        uintptr_t sum = 0;
+        int n = 1 << 16;
+        int r, i;
+
+        vec = Vector_new(n);
+        for (i = 0; i < n; i++)
+                Vector_append(vec, (void *) (uintptr_t) i);
+
+        for (r = 0; r < reps; r++)
+                for (i = 0; i < Vector_length(vec); i++)
+                        sum += (uintptr_t) Vector_get(vec, i);
+
+        sink += sum;
+        Vector_free(&vec);
+
+        return (long) reps * n;
+}
+
+long bench_vector_iter(int reps)
+{
+        Vector_T vec;
+        Iter_T it;
+        void *elem;
+        uintptr_t sum = 0;
+        int n = 1 << 16;
+        int r, i;
+
+        vec = Vector_new(n);
+        for (i = 0; i < n; i++)
+                Vector_append(vec, (void *) (uintptr_t) i);
+
+        for (r = 0; r < reps; r++) {
+                it = Vector_iter(vec);
+                CDS_FOREACH(elem, it)
+                        sum += (uintptr_t) elem;
+        }
+
+        sink += sum;
+        Vector_free(&vec);
+
+        return (long) reps * n;
+}
+
+long bench_iter_pipeline(int reps)
+{
+        Vector_T vec, out;
+        Iter_T src, evens, doubled;
+        int n = 1 << 16;
+        int r, i;
+
+        vec = Vector_new(n);
+        for (i = 0; i < n; i++)
+                Vector_append(vec, (void *) (uintptr_t) i);
+
+        for (r = 0; r < reps; r++) {
+                src = Vector_iter(vec);
+                evens = Iter_filter(&src, keep_even, NULL);
+                doubled = Iter_map(&evens, double_elem, NULL);
+                out = Vector_collect(&doubled);
+                sink += Vector_length(out);
+                Vector_free(&out);
+        }
+
+        Vector_free(&vec);
+
+        return (long) reps * n;
+}
+
+long bench_vector_prepend(int reps)
+{
+        Vector_T vec;
+        int n = 1 << 11;
+        int r, i;
+
+        for (r = 0; r < reps; r++) {
+                vec = Vector_new(0);
+                for (i = 0; i < n; i++)
+                        Vector_prepend(vec, &payload);
+                sink += Vector_length(vec);
+                Vector_free(&vec);
+        }
+
+        return (long) reps * n;
+}
+
+long bench_vector_remove(int reps)
+{
+        Vector_T vec;
+        int n = 1 << 11;
+        int r, i;
+
+        for (r = 0; r < reps; r++) {
+                vec = Vector_new(n);
+                for (i = 0; i < n; i++)
+                        Vector_append(vec, &payload);
+                while (Vector_length(vec) > 0)
+                        Vector_removelo(vec);
+                Vector_free(&vec);
+        }
+
+        return (long) reps * n;
+}
+
+long bench_vector_new_free(int reps)
+{
+        Vector_T vecs[16];
+        int n = 1 << 12;
+        int r, i, j;
+
+        for (r = 0; r < reps; r++) {
+                for (i = 0; i < n; i += 16) {
+                        for (j = 0; j < 16; j++) {
+                                vecs[j] = Vector_new(0);
+                                Vector_append(vecs[j], &payload);
+                                Vector_resize(vecs[j], (i + j) & 63);
+                        }
+                        for (j = 0; j < 16; j++) {
+                                sink += Vector_length(vecs[j]);
+                                Vector_free(&vecs[j]);
+                        }
+                }
+        }
+
+        return (long) reps * n;
+}
+
+long bench_vector_new_free_cached(int reps)
+{
+        long ops;
+
+        Vector_cache_enable(16);
+        ops = bench_vector_new_free(reps);
+        Vector_cache_free();
+
+        return ops;
+}
+
+long bench_vector_radix_sort(int reps)
+{
+        Vector_T vec;
+        unsigned state = 1;
+        int n = 1 << 16;
+        int r, i;
+
+        vec = Vector_new(n);
+        for (r = 0; r < reps; r++) {
+                Vector_resize(vec, 0);
+                for (i = 0; i < n; i++) {
+                        state = state * 1103515245u + 12345u;
+                        Vector_append(vec, (void *) (uintptr_t) state);
+                }
+                Vector_radix_sort(vec, NULL, NULL);
+                sink += (uintptr_t) Vector_get(vec, 0);
+        }
+
+        Vector_free(&vec);
+
+        return (long) reps * n;
+}
+
+long bench_topk(int reps)
+{
+        Vector_T vec;
+        TopK_T top;
+        unsigned state = 1;
+        int n = 1 << 16;
+        int r, i;
+
+        vec = Vector_new(n);
+        for (i = 0; i < n; i++) {
+                state = state * 1103515245u + 12345u;
+                Vector_append(vec, (void *) (uintptr_t) state);
+        }
+
+        for (r = 0; r < reps; r++) {
+                top = TopK_new(100, cmp_elem, NULL);
+                TopK_push_vector(top, vec);
+                sink += (uintptr_t) TopK_min(top);
+                TopK_free(&top);
+        }
+
+        Vector_free(&vec);
+
+        return (long) reps * n;
+}
+
+long bench_vector_intersect(int reps)
+{
+        Vector_T a, b, out;
+        unsigned state = 1;
+        int n = 1 << 16;
+        int r, i;
+
+        a = Vector_new(n);
+        b = Vector_new(n);
+        for (i = 0; i < n; i++) {
+                state = state * 1103515245u + 12345u;
+                Vector_append(a, (void *) (uintptr_t) (state >> 14));
+                state = state * 1103515245u + 12345u;
+                Vector_append(b, (void *) (uintptr_t) (state >> 14));
+        }
+        Vector_dedup_par(a, NULL, NULL, 1);
+        Vector_dedup_par(b, NULL, NULL, 1);
+
+        for (r = 0; r < reps; r++) {
+                out = Vector_intersect(a, b, NULL, NULL);
+                sink += Vector_length(out);
+                Vector_free(&out);
+        }
+
+        Vector_free(&a);
+        Vector_free(&b);
+
+        return (long) reps * 2 * n;
+}
+
+long bench_deque_prepend(int reps)
+{
+        Deque_T deque;
+        int n = 1 << 16;
+        int r, i;
+
+        for (r = 0; r < reps; r++) {
+                deque = Deque_new(0);
+                for (i = 0; i < n; i++)
+                        Deque_prepend(deque, &payload);
+                sink += Deque_length(deque);
+                Deque_free(&deque);
+        }
+
+        return (long) reps * n;
+}
+
+long bench_deque_get(int reps)
+{
+        Deque_T deque;
+        uintptr_t sum = 0;
+        int n = 1 << 16;
+        int r, i;
+
+        deque = Deque_new(0);
+        for (i = 0; i < n; i++)
+                Deque_append(deque, (void *) (uintptr_t) i);
+
+        for (r = 0; r < reps; r++)
+                for (i = 0; i < n; i++)
+                        sum += (uintptr_t) Deque_get(deque, i);
+
+        sink += sum;
+        Deque_free(&deque);
+
+        return (long) reps * n;
+}
+
+long bench_dlist_append(int reps)
+{
+        DLinkedList_T list;
+        int n = 1 << 16;
+        int r, i;
+
+        for (r = 0; r < reps; r++) {
+                list = DLinkedList_new(0);
+                for (i = 0; i < n; i++)
+                        DLinkedList_append(list, &payload);
+                sink += DLinkedList_length(list);
+                DLinkedList_free(&list);
+        }
+
+        return (long) reps * n;
+}
+
+long bench_dlist_prepend(int reps)
+{
+        DLinkedList_T list;
+        int n = 1 << 16;
+        int r, i;
+
+        for (r = 0; r < reps; r++) {
+                list = DLinkedList_new(n / 2);
+                for (i = 0; i < n; i++)
+                        DLinkedList_prepend(list, &payload);
+                sink += DLinkedList_length(list);
+                DLinkedList_free(&list);
+        }
+
+        return (long) reps * n;
+}
+
+long bench_dlist_get(int reps)
+{
+        DLinkedList_T list;
+        uintptr_t sum = 0;
+        int n = 1 << 11;
+        int r, i;
+
+        list = DLinkedList_new(0);
+        for (i = 0; i < n; i++)
+                DLinkedList_append(list, (void *) (uintptr_t) i);
+
+        for (r = 0; r < reps; r++)
+                for (i = 0; i < n; i++)
+                        sum += (uintptr_t) DLinkedList_get(list, i);
+
+        sink += sum;
+        DLinkedList_free(&list);
+
+        return (long) reps * n;
+}
+
+long bench_dlist_iter(int reps)
+{
+        DLinkedList_T list;
+        Iter_T it;
+        void *elem;
+        uintptr_t sum = 0;
+        int n = 1 << 11;
+        int r, i;
+
+        list = DLinkedList_new(0);
+        for (i = 0; i < n; i++)
+                DLinkedList_append(list, (void *) (uintptr_t) i);
+
+        for (r = 0; r < reps; r++) {
+                it = DLinkedList_iter(list);
+                CDS_FOREACH(elem, it)
+                        sum += (uintptr_t) elem;
+        }
+
+        sink += sum;
+        DLinkedList_free(&list);
+
+        return (long) reps * n;
+}
+
+long bench_dlist_set(int reps)
+{
+        DLinkedList_T list;
+        int n = 1 << 11;
+        int r, i;
+
+        list = DLinkedList_new(n);
+        for (i = 0; i < n; i++)
+                DLinkedList_append(list, NULL);
+
+        for (r = 0; r < reps; r++)
+                for (i = 0; i < n; i++)
+                        DLinkedList_set(list, &payload, i);
+
+        sink += (uintptr_t) DLinkedList_first(list);
+        DLinkedList_free(&list);
+
+        return (long) reps * n;
+}
+
+long bench_dlist_new_free(int reps)
+{
+        DLinkedList_T list;
+        int n = 1 << 12;
+        int r, i;
+
+        for (r = 0; r < reps; r++) {
+                for (i = 0; i < n; i++) {
+                        list = DLinkedList_new(i & 63);
+                        sink += DLinkedList_length(list);
+                        DLinkedList_free(&list);
+                }
+        }
+
+        return (long) reps * n;
+}
+
+long bench_dlist_clear(int reps)
+{
+        DLinkedList_T list;
+        int n = 1 << 16;
+        int r, i;
+
+        for (r = 0; r < reps; r++) {
+                list = DLinkedList_new(0);
+                DLinkedList_own(list, NULL, discard_batch, NULL);
+                for (i = 0; i < n; i++)
+                        DLinkedList_append(list, &payload);
+                DLinkedList_clear(&list);
+        }
+
+        return (long) reps * n;
+}
+
+void discard_batch(void **elems, int length, void *cl)
+{
+        (void) cl;
+        sink += (uintptr_t) elems[length - 1];
+}
+
+int cmp_elem(void *a, void *b, void *cl)
+{
+        (void) cl;
+        return ((uintptr_t) a > (uintptr_t) b) -
+               ((uintptr_t) a < (uintptr_t) b);
+}
+
+bool keep_even(void *elem, void *cl)
+{
+        (void) cl;
+        return (uintptr_t) elem % 2 == 0;
+}
+
+void *double_elem(void *elem, void *cl)
+{
+        (void) cl;
+        return (void *) ((uintptr_t) elem * 2);
+}
+
+double elapsed_ns(const struct timespec *start)
+{
+        struct timespec now;
+
+        clock_gettime(CLOCK_MONOTONIC, &now);
+
+        return (now.tv_sec - start->tv_sec) * 1e9 +
+               (now.tv_nsec - start->tv_nsec);
+}
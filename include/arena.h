@@ -0,0 +1,191 @@
+/*
+ *      filename:       arena.h
+ *      author:         @keiferchiang
+ *      date:           18 Oct 2026
+ *      version:        0.0.1
+ *
+ *      description:    Interface for the Arena module, a region
+ *                      (bump) allocator. Memory allocated from an
+ *                      Arena is never freed individually; it is
+ *                      released all at once by Arena_reset,
+ *                      Arena_rewind or Arena_free
+ */
+
+/*-------------------------------------
+ * C Preprocessor Directives
+ -------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <limits.h>
+#include <assert.h>
+
+#ifndef ARENA_H_
+#define ARENA_H_
+
+/*-------------------------------------
+ * Representation
+ -------------------------------------*/
+typedef struct arena_t *Arena_T;
+
+/*
+ * Position in an Arena returned by Arena_mark. Only meaningful to
+ * Arena_rewind on the Arena that produced it
+ */
+typedef struct arena_mark_t {
+        void *chunk;
+        char *avail;
+} Arena_Mark_T;
+
+/*-------------------------------------
+ * Function Prototypes
+ -------------------------------------*/
+/*
+ * Arena_new
+ *
+ * Creates and returns a new, empty Arena. hint is the size in
+ * bytes of the chunks the Arena carves allocations out of; 0
+ * selects a default. When huge is true, chunks are rounded up to
+ * 2MB and backed by transparent huge pages where the platform
+ * supports them
+ *
+ * CREs         n/a
+ * UREs         n/a
+ *
+ * @param       size_t          Chunk size hint in bytes
+ * @param       bool            Back chunks with huge pages
+ * @return      Arena_T         A pointer to an instance of
+ *                              an Arena
+ */
+Arena_T Arena_new(size_t hint, bool huge);
+
+/*
+ * Arena_free
+ *
+ * Releases every chunk owned by the Arena, then the Arena itself.
+ * Every pointer previously returned by Arena_alloc is invalidated
+ *
+ * CREs         arena == NULL
+ * UREs         using memory allocated from arena
+ *
+ * @param       Arena_T *       Arena to be freed
+ * @return      n/a
+ */
+void Arena_free(Arena_T *arena);
+
+/*
+ * Arena_alloc
+ *
+ * Returns a pointer to nbytes of uninitialized memory aligned to
+ * align bytes. An align of 0 selects the alignment malloc would
+ * guarantee
+ *
+ * CREs         arena == NULL
+ *              align not 0 and not a power of two
+ *              nbytes too large to fit in a chunk with its alignment
+ * UREs         n/a
+ *
+ * @param       Arena_T         Arena to allocate from
+ * @param       size_t          Number of bytes to allocate
+ * @param       size_t          Alignment of the allocation
+ * @return      void *          Pointer to the allocation
+ */
+void *Arena_alloc(Arena_T arena, size_t nbytes, size_t align);
+
+/*
+ * Arena_calloc
+ *
+ * Same as Arena_alloc, but the memory is zero-filled
+ *
+ * CREs         arena == NULL
+ *              align not 0 and not a power of two
+ *              nbytes too large to fit in a chunk with its alignment
+ * UREs         n/a
+ *
+ * @param       Arena_T         Arena to allocate from
+ * @param       size_t          Number of bytes to allocate
+ * @param       size_t          Alignment of the allocation
+ * @return      void *          Pointer to the allocation
+ */
+void *Arena_calloc(Arena_T arena, size_t nbytes, size_t align);
+
+//////////////////////////////////
+//      Scope Functions         //
+//////////////////////////////////
+/*
+ * Arena_mark
+ *
+ * Returns the current position of the Arena. Passing the mark to
+ * Arena_rewind releases everything allocated after this call
+ *
+ * CREs         arena == NULL
+ * UREs         n/a
+ *
+ * @param       Arena_T         Arena to mark
+ * @return      Arena_Mark_T    Current position of the Arena
+ */
+Arena_Mark_T Arena_mark(Arena_T arena);
+
+/*
+ * Arena_rewind
+ *
+ * Releases every allocation made after the given mark. Chunks
+ * emptied by the rewind are kept for reuse by later allocations
+ *
+ * CREs         arena == NULL
+ * UREs         mark taken from another Arena
+ *              mark taken after a prior rewind or reset past it
+ *              using memory allocated after the mark
+ *
+ * @param       Arena_T         Arena to rewind
+ * @param       Arena_Mark_T    Position to rewind to
+ * @return      n/a
+ */
+void Arena_rewind(Arena_T arena, Arena_Mark_T mark);
+
+/*
+ * Arena_reset
+ *
+ * Releases every allocation in the Arena in O(chunks). The chunks
+ * themselves are kept for reuse; use Arena_free to return them to
+ * the system
+ *
+ * CREs         arena == NULL
+ * UREs         using memory allocated from arena
+ *
+ * @param       Arena_T         Arena to reset
+ * @return      n/a
+ */
+void Arena_reset(Arena_T arena);
+
+//////////////////////////////////
+//      Thread Functions        //
+//////////////////////////////////
+/*
+ * Arena_thread
+ *
+ * Returns the calling thread's own Arena, creating it on first
+ * use. It must only be used by the calling thread
+ *
+ * CREs         n/a
+ * UREs         passing the Arena to another thread
+ *
+ * @return      Arena_T         The calling thread's Arena
+ */
+Arena_T Arena_thread(void);
+
+/*
+ * Arena_thread_free
+ *
+ * Frees the calling thread's Arena, if it has one. Threads that
+ * used Arena_thread should call this before exiting
+ *
+ * CREs         n/a
+ * UREs         using memory allocated from the thread's Arena
+ *
+ * @return      n/a
+ */
+void Arena_thread_free(void);
+
+#endif
@@ -0,0 +1,229 @@
+/*
+ *      filename:       deque.h
+ *      author:         @keiferchiang
+ *      date:           18 Oct 2026
+ *      version:        0.0.1
+ *
+ *      description:    Interface for the Deque module, a double-ended
+ *                      queue stored as a map of fixed-size blocks. It
+ *                      appends and removes at both ends in O(1), indexes
+ *                      in O(1), and never moves an element once stored,
+ *                      so the address of its slot stays valid until the
+ *                      element itself is removed
+ *
+ *      usage:          Deque_append(window, sample);
+ *                      if (Deque_length(window) > WIDTH)
+ *                              Deque_removelo(window);
+ */
+
+/*-------------------------------------
+ * C Preprocessor Directives
+ -------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <limits.h>
+#include <assert.h>
+
+#ifndef DEQUE_H_
+#define DEQUE_H_
+
+#include "iter.h"
+
+/*-------------------------------------
+ * Representation
+ -------------------------------------*/
+typedef struct deque_t *Deque_T;
+
+/*-------------------------------------
+ * Function Prototypes
+ -------------------------------------*/
+/*
+ * Deque_new
+ *
+ * Given a hint of the number of elements, creates and returns an
+ * empty Deque
+ *
+ * CREs         0 > hint >= INT_MAX
+ * UREs         n/a
+ *
+ * @param       int             Hint of the number of elements
+ * @return      Deque_T         An empty Deque
+ */
+Deque_T Deque_new(int hint);
+
+/*
+ * Deque_free
+ *
+ * Recycles heap allocated memory for the Deque. It is the client's
+ * responsibility to free the elements first
+ *
+ * CREs         deque == NULL
+ *              *deque == NULL
+ * UREs         n/a
+ *
+ * @param       Deque_T *       Pointer to the Deque
+ * @return      n/a
+ */
+void Deque_free(Deque_T *deque);
+
+/*
+ * Deque_length
+ *
+ * Returns the number of elements in the Deque
+ *
+ * CREs         deque == NULL
+ * UREs         n/a
+ *
+ * @param       Deque_T         Deque to query
+ * @return      int             Number of elements
+ */
+int Deque_length(Deque_T deque);
+
+/*
+ * Deque_get
+ *
+ * Returns the element at index, counting from the front, in O(1)
+ *
+ * CREs         deque == NULL
+ *              index out of bounds
+ * UREs         n/a
+ *
+ * @param       Deque_T         Deque to query
+ * @param       int             Index of the element
+ * @return      void *          The element
+ */
+void *Deque_get(Deque_T deque, int index);
+
+/*
+ * Deque_first
+ *
+ * Returns the front element, or NULL if the Deque is empty
+ *
+ * CREs         deque == NULL
+ * UREs         n/a
+ *
+ * @param       Deque_T         Deque to query
+ * @return      void *          The front element
+ */
+void *Deque_first(Deque_T deque);
+
+/*
+ * Deque_last
+ *
+ * Returns the back element, or NULL if the Deque is empty
+ *
+ * CREs         deque == NULL
+ * UREs         n/a
+ *
+ * @param       Deque_T         Deque to query
+ * @return      void *          The back element
+ */
+void *Deque_last(Deque_T deque);
+
+/*
+ * Deque_slot
+ *
+ * Returns the address of the slot holding the element at index.
+ * Appending and prepending never move elements, so the address
+ * stays valid until that element is removed
+ *
+ * CREs         deque == NULL
+ *              index out of bounds
+ * UREs         using the address after its element is removed
+ *
+ * @param       Deque_T         Deque to query
+ * @param       int             Index of the element
+ * @return      void **         Address of its slot
+ */
+void **Deque_slot(Deque_T deque, int index);
+
+/*
+ * Deque_set
+ *
+ * Replaces the element at index
+ *
+ * CREs         deque == NULL
+ *              index out of bounds
+ * UREs         n/a
+ *
+ * @param       Deque_T         Deque to modify
+ * @param       void *          New element
+ * @param       int             Index of the element
+ * @return      n/a
+ */
+void Deque_set(Deque_T deque, void *elem, int index);
+
+/*
+ * Deque_append
+ *
+ * Adds elem at the back in O(1)
+ *
+ * CREs         deque == NULL
+ *              length == INT_MAX
+ * UREs         n/a
+ *
+ * @param       Deque_T         Deque to extend
+ * @param       void *          Element to add
+ * @return      n/a
+ */
+void Deque_append(Deque_T deque, void *elem);
+
+/*
+ * Deque_prepend
+ *
+ * Adds elem at the front in O(1)
+ *
+ * CREs         deque == NULL
+ *              length == INT_MAX
+ * UREs         n/a
+ *
+ * @param       Deque_T         Deque to extend
+ * @param       void *          Element to add
+ * @return      n/a
+ */
+void Deque_prepend(Deque_T deque, void *elem);
+
+/*
+ * Deque_removehi
+ *
+ * Removes the back element in O(1)
+ *
+ * CREs         deque == NULL
+ *              Deque is empty
+ * UREs         n/a
+ *
+ * @param       Deque_T         Deque to shrink
+ * @return      n/a
+ */
+void Deque_removehi(Deque_T deque);
+
+/*
+ * Deque_removelo
+ *
+ * Removes the front element in O(1)
+ *
+ * CREs         deque == NULL
+ *              Deque is empty
+ * UREs         n/a
+ *
+ * @param       Deque_T         Deque to shrink
+ * @return      n/a
+ */
+void Deque_removelo(Deque_T deque);
+
+/*
+ * Deque_iter
+ *
+ * Returns an iterator over the elements from front to back
+ *
+ * CREs         deque == NULL
+ * UREs         the Deque changes while iterating
+ *
+ * @param       Deque_T         Deque to iterate
+ * @return      Iter_T          Iterator over the elements
+ */
+Iter_T Deque_iter(Deque_T deque);
+
+#endif
@@ -5,6 +5,14 @@
  *      version:        0.0.1
  *
  *      description:    Interface of the DLinkedList module
+ *
+ *      note:           Lists not made with DLinkedList_new_arena take
+ *                      their headers and nodes from the Pool (pool.h),
+ *                      which keeps freed ones in per-thread caches. A
+ *                      thread's cache goes back to the Pool's shared
+ *                      depot when the thread exits; Pool_flush hands
+ *                      it over sooner and Pool_trim returns the depot
+ *                      to the system allocator
  */
 /*-------------------------------------
  * C Preprocessor Directives
@@ -19,6 +27,11 @@
 #ifndef DLINKEDLIST_H_
 #define DLINKEDLIST_H_
 
+#include "arena.h"
+#include "iter.h"
+#include "pool.h"
+#include "serial.h"
+
 /*-------------------------------------
  * Representation
  -------------------------------------*/
@@ -43,12 +56,33 @@ typedef struct dlinkedlist_t *DLinkedList_T;
  */
 DLinkedList_T DLinkedList_new(int hint);
 
+/*
+ * DLinkedList_new_arena
+ *
+ * Same as DLinkedList_new, but the DLinkedList and all of its
+ * nodes are allocated from the given Arena. Such a DLinkedList
+ * needs no DLinkedList_free; resetting or freeing the Arena
+ * reclaims it without walking the nodes
+ *
+ * CREs         0 > hint >= INT_MAX
+ *              arena == NULL
+ * UREs         using the DLinkedList after its Arena is reset
+ *
+ * @param       int             Hint of the default size of
+ * 				the DLinkedList
+ * @param       Arena_T         Arena to allocate from
+ * @return      DLinkedList_T   A pointer to an instance of
+ * 				a linked-list
+ */
+DLinkedList_T DLinkedList_new_arena(int hint, Arena_T arena);
+
 /*
  * DLinkedList_free
  *
  * Recycles heap allocated memory for DLinkedList. It is the
  * client's responsibility to free every element in the
- * DLinkedList before freeing the DLinkedList itself
+ * DLinkedList before freeing the DLinkedList itself.
+ * Arena-backed DLinkedLists are left to their Arena
  *
  * CREs         list == NULL
  * UREs         elements in list != NULL
@@ -58,6 +92,48 @@ DLinkedList_T DLinkedList_new(int hint);
  */
 void DLinkedList_free(DLinkedList_T *list);
 
+//////////////////////////////////
+//      Ownership Functions     //
+//////////////////////////////////
+/*
+ * DLinkedList_own
+ *
+ * Hands ownership of the DLinkedList's elements to the
+ * DLinkedList. DLinkedList_clear then destroys them with
+ * free_batch, called on consecutive runs of elements, or else
+ * with free_elem, called once per non-NULL element. Passing NULL
+ * for both restores the default, which is to release elements
+ * with free
+ *
+ * CREs         list == NULL
+ * UREs         n/a
+ *
+ * @param       DLinkedList_T   DLinkedList owning the elements
+ * @param       function        Destroys a single element
+ * @param       function        Destroys an array of elements
+ * @param       void *          Closure passed to either function
+ * @return      n/a
+ */
+void DLinkedList_own(DLinkedList_T list,
+                     void free_elem(void *elem, void *cl),
+                     void free_batch(void **elems, int length, void *cl),
+                     void *cl);
+
+/*
+ * DLinkedList_clear
+ *
+ * Destroys every element in the DLinkedList as set up by
+ * DLinkedList_own and frees the DLinkedList, in a single walk
+ * over the nodes
+ *
+ * CREs         list == NULL
+ * UREs         elements not owned by the DLinkedList
+ *
+ * @param       DLinkedList_T * DLinkedList to be cleared and freed
+ * @return      n/a
+ */
+void DLinkedList_clear(DLinkedList_T *list);
+
 //////////////////////////////////
 //      Getter Functions        //
 //////////////////////////////////
@@ -226,4 +302,119 @@ void DLinkedList_removehi(DLinkedList_T list);
  */
 void DLinkedList_removelo(DLinkedList_T list);
 
+//////////////////////////////////
+//      Iteration Functions     //
+//////////////////////////////////
+/*
+ * DLinkedList_iter
+ *
+ * Returns an iterator over the elements of the DLinkedList, first
+ * to last. Advancing it is a single node hop, so a full walk is
+ * O(n) where a DLinkedList_get loop is O(n^2)
+ *
+ * CREs         list == NULL
+ * UREs         changing the DLinkedList while iterating
+ *
+ * @param       DLinkedList_T   DLinkedList to iterate over
+ * @return      Iter_T          Iterator over the elements
+ */
+Iter_T DLinkedList_iter(DLinkedList_T list);
+
+//////////////////////////////////
+//      Stream Functions        //
+//////////////////////////////////
+/*
+ * DLinkedList_write
+ *
+ * Writes every element of the DLinkedList to fp in the Serial
+ * stream format, encoding each with the given codec. Returns false
+ * on a write or encode error
+ *
+ * CREs         list == NULL
+ *              fp == NULL
+ *              codec == NULL or codec->encode == NULL
+ * UREs         n/a
+ *
+ * @param       DLinkedList_T           DLinkedList to write
+ * @param       FILE *                  Stream to write to
+ * @param       const Serial_Codec_T *  Codec for the elements
+ * @return      bool                    true on success
+ */
+bool DLinkedList_write(DLinkedList_T list, FILE *fp,
+                       const Serial_Codec_T *codec);
+
+/*
+ * DLinkedList_read
+ *
+ * Reads a Serial stream written by DLinkedList_write or
+ * Vector_write from fp into a new DLinkedList. On a read or format
+ * error, elements decoded so far are released with codec->free, if
+ * set, and NULL is returned
+ *
+ * CREs         fp == NULL
+ *              codec == NULL or codec->decode == NULL
+ * UREs         n/a
+ *
+ * @param       FILE *                  Stream to read from
+ * @param       const Serial_Codec_T *  Codec for the elements
+ * @return      DLinkedList_T           New DLinkedList, or NULL
+ */
+DLinkedList_T DLinkedList_read(FILE *fp, const Serial_Codec_T *codec);
+
+//////////////////////////////////
+//      Gather Functions        //
+//////////////////////////////////
+/*
+ * DLinkedList_iovec
+ *
+ * Describes the buffers held by the DLinkedList as an iovec array,
+ * for writev or vmsplice without first copying them together. Each
+ * element is taken to point at a buffer of length(elem, cl) bytes;
+ * runs of nodes whose buffers sit back to back in memory share one
+ * iovec, and empty buffers are skipped. Starts at element *index
+ * and fills at most iovcnt entries, then advances *index past the
+ * elements described. Finding *index costs a traversal, so prefer
+ * DLinkedList_writev for long lists
+ *
+ * CREs         list == NULL
+ *              index == NULL or 0 > *index > length
+ *              iov == NULL or iovcnt <= 0
+ *              length == NULL
+ * UREs         changing the DLinkedList or its buffers before the
+ *              iovecs are used
+ *
+ * @param       DLinkedList_T   DLinkedList of buffers
+ * @param       int *           First element to describe; set to
+ *                              the first element not described
+ * @param       struct iovec *  Array to fill
+ * @param       int             Capacity of iov
+ * @param       function        Byte length of an element's buffer
+ * @param       void *          Closure passed to length
+ * @return      int             Number of iovecs filled
+ */
+int DLinkedList_iovec(DLinkedList_T list, int *index, struct iovec *iov,
+                      int iovcnt, size_t length(void *elem, void *cl),
+                      void *cl);
+
+/*
+ * DLinkedList_writev
+ *
+ * Writes the buffers held by the DLinkedList to fd in order,
+ * gathering up to SERIAL_IOV_MAX node runs per system call in a
+ * single walk of the list. Returns the number of bytes written, or
+ * -1 on error
+ *
+ * CREs         list == NULL
+ *              length == NULL
+ * UREs         n/a
+ *
+ * @param       DLinkedList_T   DLinkedList of buffers
+ * @param       int             File descriptor to write to
+ * @param       function        Byte length of an element's buffer
+ * @param       void *          Closure passed to length
+ * @return      ssize_t         Bytes written, or -1
+ */
+ssize_t DLinkedList_writev(DLinkedList_T list, int fd,
+                           size_t length(void *elem, void *cl), void *cl);
+
 #endif
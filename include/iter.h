@@ -0,0 +1,404 @@
+/*
+ *      filename:       iter.h
+ *      author:         @keiferchiang
+ *      date:           18 Oct 2026
+ *      version:        0.0.1
+ *
+ *      description:    Interface for the Iter module, a forward
+ *                      iterator shared by the containers. An Iter_T
+ *                      is a small value that lives on the caller's
+ *                      stack; creating and advancing one never
+ *                      allocates. Iter_next and Iter_peek are inline,
+ *                      so walking a Vector is a pointer increment and
+ *                      walking a DLinkedList is a node hop
+ *
+ *      usage:          Iter_T it = Vector_iter(vec);
+ *                      Test_T test;
+ *
+ *                      CDS_FOREACH(test, it)
+ *                              printf("%d\n", test->y);
+ */
+
+/*-------------------------------------
+ * C Preprocessor Directives
+ -------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <limits.h>
+#include <assert.h>
+#include <stddef.h>
+
+#ifndef ITER_H_
+#define ITER_H_
+
+/*
+ * Runs the statement that follows once per remaining element of the
+ * Iter_T iter, with the element assigned to elem
+ */
+#define CDS_FOREACH(elem, iter)                                         \
+        for (void *cds_elem_; Iter_next(&(iter), &cds_elem_) &&        \
+             ((elem) = cds_elem_, true); )
+
+/*-------------------------------------
+ * Representation
+ -------------------------------------*/
+typedef enum iter_kind_t {
+        ITER_EMPTY,
+        ITER_ARRAY,
+        ITER_LINKED,
+        ITER_FUNC
+} Iter_Kind_T;
+
+/*
+ * Iterator state. The fields used depend on kind, and are private
+ * to this module and the containers that build iterators
+ *
+ * ITER_ARRAY   pos walks the slots in [pos, end)
+ * ITER_LINKED  link walks remaining nodes; each holds its element
+ *              at elem_off and its successor at next_off
+ * ITER_FUNC    next produces elements from state; peek buffers one
+ *              element for Iter_peek. Adapters keep the iterators
+ *              they pull from in src and other, their callback in
+ *              fn and its closure in cl
+ */
+typedef struct iter_t {
+        Iter_Kind_T kind;
+        void **pos;
+        void **end;
+        void *link;
+        int remaining;
+        size_t elem_off;
+        size_t next_off;
+        bool (*next)(struct iter_t *iter, void **elem);
+        void *state;
+        bool peeked;
+        void *peek;
+        struct iter_t *src;
+        struct iter_t *other;
+        union {
+                void *(*map)(void *elem, void *cl);
+                bool (*pred)(void *elem, void *cl);
+                void *(*combine)(void *a, void *b, void *cl);
+        } fn;
+        void *cl;
+} Iter_T;
+
+/*-------------------------------------
+ * Function Prototypes
+ -------------------------------------*/
+//////////////////////////////////
+//      Constructors            //
+//////////////////////////////////
+/*
+ * Iter_array
+ *
+ * Returns an iterator over the length slots starting at array
+ *
+ * CREs         array == NULL and length > 0
+ *              length < 0
+ * UREs         array changes while iterating
+ *
+ * @param       void **         First slot
+ * @param       int             Number of slots
+ * @return      Iter_T          Iterator over the slots
+ */
+Iter_T Iter_array(void **array, int length);
+
+/*
+ * Iter_linked
+ *
+ * Returns an iterator over length nodes of a singly or doubly
+ * linked chain starting at first. Each node holds its element as a
+ * void * at byte offset elem_off and the next node at next_off, so
+ * any container's node type can be walked without knowing it
+ *
+ * CREs         first == NULL and length > 0
+ *              length < 0
+ * UREs         fewer than length nodes follow first
+ *
+ * @param       void *          First node
+ * @param       int             Number of nodes to visit
+ * @param       size_t          offsetof the element in a node
+ * @param       size_t          offsetof the next pointer in a node
+ * @return      Iter_T          Iterator over the nodes' elements
+ */
+Iter_T Iter_linked(void *first, int length, size_t elem_off,
+                   size_t next_off);
+
+/*
+ * Iter_func
+ *
+ * Returns an iterator whose elements are produced by next. next
+ * stores the next element in *elem and returns true, or returns
+ * false when there are none left. state is kept in the iterator
+ * for next to use
+ *
+ * CREs         next == NULL
+ * UREs         n/a
+ *
+ * @param       function        Produces the next element
+ * @param       void *          State for next
+ * @return      Iter_T          Iterator over next's elements
+ */
+Iter_T Iter_func(bool next(Iter_T *iter, void **elem), void *state);
+
+//////////////////////////////////
+//      Adapters                //
+//////////////////////////////////
+/*
+ * Adapters are lazy: each returns an iterator that pulls from the
+ * iterators it was given only as its own elements are requested, so
+ * a chain of them runs in one pass with no intermediate container.
+ * The source iterators are held by reference and must outlive the
+ * adapter; they are advanced as the adapter is
+ */
+
+/*
+ * Iter_map
+ *
+ * Returns an iterator over map(elem, cl) for each element of src
+ *
+ * CREs         src == NULL
+ *              map == NULL
+ * UREs         src goes out of scope before the adapter
+ *
+ * @param       Iter_T *        Source iterator
+ * @param       function        Transforms an element
+ * @param       void *          Closure passed to map
+ * @return      Iter_T          Iterator over the mapped elements
+ */
+Iter_T Iter_map(Iter_T *src, void *map(void *elem, void *cl), void *cl);
+
+/*
+ * Iter_filter
+ *
+ * Returns an iterator over the elements of src for which pred
+ * returns true
+ *
+ * CREs         src == NULL
+ *              pred == NULL
+ * UREs         src goes out of scope before the adapter
+ *
+ * @param       Iter_T *        Source iterator
+ * @param       function        Predicate on an element
+ * @param       void *          Closure passed to pred
+ * @return      Iter_T          Iterator over the kept elements
+ */
+Iter_T Iter_filter(Iter_T *src, bool pred(void *elem, void *cl), void *cl);
+
+/*
+ * Iter_take
+ *
+ * Returns an iterator over at most the first n elements of src.
+ * src is not advanced past the n-th element
+ *
+ * CREs         src == NULL
+ *              n < 0
+ * UREs         src goes out of scope before the adapter
+ *
+ * @param       Iter_T *        Source iterator
+ * @param       int             Most elements to produce
+ * @return      Iter_T          Iterator over the leading elements
+ */
+Iter_T Iter_take(Iter_T *src, int n);
+
+/*
+ * Iter_zip
+ *
+ * Returns an iterator over combine(a, b, cl) for each pair of
+ * elements taken in step from first and second. Ends with the
+ * shorter of the two
+ *
+ * CREs         first == NULL or second == NULL
+ *              combine == NULL
+ * UREs         either source goes out of scope before the adapter
+ *
+ * @param       Iter_T *        First source iterator
+ * @param       Iter_T *        Second source iterator
+ * @param       function        Combines a pair of elements
+ * @param       void *          Closure passed to combine
+ * @return      Iter_T          Iterator over the combined elements
+ */
+Iter_T Iter_zip(Iter_T *first, Iter_T *second,
+                void *combine(void *a, void *b, void *cl), void *cl);
+
+/*
+ * Iter_chain
+ *
+ * Returns an iterator over the elements of first followed by the
+ * elements of second
+ *
+ * CREs         first == NULL or second == NULL
+ * UREs         either source goes out of scope before the adapter
+ *
+ * @param       Iter_T *        First source iterator
+ * @param       Iter_T *        Second source iterator
+ * @return      Iter_T          Iterator over both in turn
+ */
+Iter_T Iter_chain(Iter_T *first, Iter_T *second);
+
+//////////////////////////////////
+//      Algorithms              //
+//////////////////////////////////
+/*
+ * Iter_find
+ *
+ * Advances iter to the first element for which pred returns true,
+ * and returns it in *elem. The iterator is left just past it, so
+ * calling Iter_find again finds the next match
+ *
+ * CREs         iter == NULL
+ *              pred == NULL
+ * UREs         n/a
+ *
+ * @param       Iter_T *        Iterator to search
+ * @param       function        Predicate on an element
+ * @param       void *          Closure passed to pred
+ * @param       void **         Location of the match, may be NULL
+ * @return      bool            true if a match was found
+ */
+bool Iter_find(Iter_T *iter, bool pred(void *elem, void *cl), void *cl,
+               void **elem);
+
+/*
+ * Iter_apply
+ *
+ * Calls apply on every remaining element of iter, in order
+ *
+ * CREs         iter == NULL
+ *              apply == NULL
+ * UREs         n/a
+ *
+ * @param       Iter_T *        Iterator to drain
+ * @param       function        Called on each element
+ * @param       void *          Closure passed to apply
+ * @return      n/a
+ */
+void Iter_apply(Iter_T *iter, void apply(void *elem, void *cl), void *cl);
+
+/*
+ * Iter_reduce
+ *
+ * Folds the remaining elements of iter into accum, replacing accum
+ * with reduce(accum, elem, cl) for each, and returns the result
+ *
+ * CREs         iter == NULL
+ *              reduce == NULL
+ * UREs         n/a
+ *
+ * @param       Iter_T *        Iterator to drain
+ * @param       void *          Initial accumulator
+ * @param       function        Folds one element into accum
+ * @param       void *          Closure passed to reduce
+ * @return      void *          Final accumulator
+ */
+void *Iter_reduce(Iter_T *iter, void *accum,
+                  void *reduce(void *accum, void *elem, void *cl), void *cl);
+
+/*
+ * Iter_count
+ *
+ * Drains iter and returns the number of elements it produced
+ *
+ * CREs         iter == NULL
+ * UREs         n/a
+ *
+ * @param       Iter_T *        Iterator to drain
+ * @return      long            Number of elements
+ */
+long Iter_count(Iter_T *iter);
+
+//////////////////////////////////
+//      Inline Functions        //
+//////////////////////////////////
+/*
+ * Iter_next
+ *
+ * Stores the next element of iter in *elem and advances past it.
+ * Returns false, leaving *elem untouched, once iter is exhausted
+ *
+ * CREs         iter == NULL
+ *              elem == NULL
+ * UREs         the underlying container changes while iterating
+ *
+ * @param       Iter_T *        Iterator to advance
+ * @param       void **         Location of the element
+ * @return      bool            true if an element was produced
+ */
+static inline bool Iter_next(Iter_T *iter, void **elem)
+{
+        assert(iter != NULL);
+        assert(elem != NULL);
+
+        switch (iter->kind) {
+        case ITER_ARRAY:
+                if (iter->pos == iter->end)
+                        return false;
+                *elem = *iter->pos++;
+                return true;
+        case ITER_LINKED:
+                if (iter->remaining == 0)
+                        return false;
+                *elem = *(void **) ((char *) iter->link + iter->elem_off);
+                iter->link = *(void **) ((char *) iter->link +
+                                         iter->next_off);
+                iter->remaining--;
+                return true;
+        case ITER_FUNC:
+                if (iter->peeked) {
+                        iter->peeked = false;
+                        *elem = iter->peek;
+                        return true;
+                }
+                return iter->next(iter, elem);
+        default:
+                return false;
+        }
+}
+
+/*
+ * Iter_peek
+ *
+ * Stores the next element of iter in *elem without advancing past
+ * it. Returns false once iter is exhausted
+ *
+ * CREs         iter == NULL
+ *              elem == NULL
+ * UREs         the underlying container changes while iterating
+ *
+ * @param       Iter_T *        Iterator to look into
+ * @param       void **         Location of the element
+ * @return      bool            true if an element is available
+ */
+static inline bool Iter_peek(Iter_T *iter, void **elem)
+{
+        assert(iter != NULL);
+        assert(elem != NULL);
+
+        switch (iter->kind) {
+        case ITER_ARRAY:
+                if (iter->pos == iter->end)
+                        return false;
+                *elem = *iter->pos;
+                return true;
+        case ITER_LINKED:
+                if (iter->remaining == 0)
+                        return false;
+                *elem = *(void **) ((char *) iter->link + iter->elem_off);
+                return true;
+        case ITER_FUNC:
+                if (!iter->peeked) {
+                        if (!iter->next(iter, &iter->peek))
+                                return false;
+                        iter->peeked = true;
+                }
+                *elem = iter->peek;
+                return true;
+        default:
+                return false;
+        }
+}
+
+#endif
@@ -0,0 +1,235 @@
+/*
+ *      filename:       jagged.h
+ *      author:         @keiferchiang
+ *      date:           18 Oct 2026
+ *      version:        0.0.1
+ *
+ *      description:    Interface for the Jagged module, a sequence of
+ *                      variable-length rows flattened into one values
+ *                      array and one offsets array (compressed sparse
+ *                      row layout). It replaces a Vector of small
+ *                      Vectors at 8 bytes of bookkeeping per row, with
+ *                      no per-row allocation or slack. Rows are built
+ *                      in order, appending to the last row only
+ *
+ *      usage:          Jagged_T jag = Jagged_new(0, 0);
+ *                      for each key:
+ *                              Jagged_add_row(jag);
+ *                              for each value:
+ *                                      Jagged_push(jag, value);
+ *                      Jagged_freeze(jag);
+ *                      elems = Jagged_row(jag, key, &n);
+ */
+
+/*-------------------------------------
+ * C Preprocessor Directives
+ -------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <limits.h>
+#include <assert.h>
+#include <stdint.h>
+
+#ifndef JAGGED_H_
+#define JAGGED_H_
+
+#include "vector.h"
+
+/*-------------------------------------
+ * Representation
+ -------------------------------------*/
+typedef struct jagged_t *Jagged_T;
+
+/*-------------------------------------
+ * Function Prototypes
+ -------------------------------------*/
+/*
+ * Jagged_new
+ *
+ * Given hints of the number of rows and of values across all rows,
+ * creates and returns an empty Jagged
+ *
+ * CREs         0 > rows >= INT_MAX
+ *              values < 0
+ * UREs         n/a
+ *
+ * @param       int             Hint of the number of rows
+ * @param       int64_t         Hint of the total number of values
+ * @return      Jagged_T        An empty Jagged with no rows
+ */
+Jagged_T Jagged_new(int rows, int64_t values);
+
+/*
+ * Jagged_free
+ *
+ * Recycles heap allocated memory for the Jagged. It is the client's
+ * responsibility to free the elements first
+ *
+ * CREs         jag == NULL
+ *              *jag == NULL
+ * UREs         n/a
+ *
+ * @param       Jagged_T *      Pointer to the Jagged
+ * @return      n/a
+ */
+void Jagged_free(Jagged_T *jag);
+
+/*
+ * Jagged_add_row
+ *
+ * Starts a new empty row after the last one and returns its index
+ *
+ * CREs         jag == NULL
+ *              jag is frozen
+ * UREs         n/a
+ *
+ * @param       Jagged_T        Jagged to extend
+ * @return      int             Index of the new row
+ */
+int Jagged_add_row(Jagged_T jag);
+
+/*
+ * Jagged_push
+ *
+ * Appends elem to the last row
+ *
+ * CREs         jag == NULL
+ *              jag has no rows
+ *              jag is frozen
+ * UREs         n/a
+ *
+ * @param       Jagged_T        Jagged to extend
+ * @param       void *          Element to append
+ * @return      n/a
+ */
+void Jagged_push(Jagged_T jag, void *elem);
+
+/*
+ * Jagged_append_row
+ *
+ * Adds a new row holding a copy of the Vector's elements and returns
+ * its index. Handy for migrating a Vector of Vectors
+ *
+ * CREs         jag == NULL
+ *              vec == NULL
+ *              jag is frozen
+ * UREs         n/a
+ *
+ * @param       Jagged_T        Jagged to extend
+ * @param       Vector_T        Elements of the new row
+ * @return      int             Index of the new row
+ */
+int Jagged_append_row(Jagged_T jag, Vector_T vec);
+
+/*
+ * Jagged_freeze
+ *
+ * Releases the slack capacity of both arrays, leaving exactly one
+ * offset per row plus one and one slot per value. A frozen Jagged
+ * can no longer gain rows or values, but elements may still be
+ * replaced with Jagged_set
+ *
+ * CREs         jag == NULL
+ * UREs         n/a
+ *
+ * @param       Jagged_T        Jagged to freeze
+ * @return      n/a
+ */
+void Jagged_freeze(Jagged_T jag);
+
+/*
+ * Jagged_row
+ *
+ * Returns a view of a row in O(1): a pointer to its first element,
+ * with its length stored in *length when length is not NULL. The
+ * view is invalidated by the next Jagged_add_row, Jagged_push,
+ * Jagged_append_row or Jagged_freeze
+ *
+ * CREs         jag == NULL
+ *              row out of bounds
+ * UREs         using the view after it is invalidated
+ *
+ * @param       Jagged_T        Jagged to query
+ * @param       int             Index of the row
+ * @param       int *           Location for the row length, or NULL
+ * @return      void **         The row's elements
+ */
+void **Jagged_row(Jagged_T jag, int row, int *length);
+
+/*
+ * Jagged_row_length
+ *
+ * Returns the number of elements in a row
+ *
+ * CREs         jag == NULL
+ *              row out of bounds
+ * UREs         n/a
+ *
+ * @param       Jagged_T        Jagged to query
+ * @param       int             Index of the row
+ * @return      int             Length of the row
+ */
+int Jagged_row_length(Jagged_T jag, int row);
+
+/*
+ * Jagged_get
+ *
+ * Returns the element at column col of a row
+ *
+ * CREs         jag == NULL
+ *              row or col out of bounds
+ * UREs         n/a
+ *
+ * @param       Jagged_T        Jagged to query
+ * @param       int             Index of the row
+ * @param       int             Index within the row
+ * @return      void *          The element
+ */
+void *Jagged_get(Jagged_T jag, int row, int col);
+
+/*
+ * Jagged_set
+ *
+ * Replaces the element at column col of a row
+ *
+ * CREs         jag == NULL
+ *              row or col out of bounds
+ * UREs         n/a
+ *
+ * @param       Jagged_T        Jagged to modify
+ * @param       void *          New element
+ * @param       int             Index of the row
+ * @param       int             Index within the row
+ * @return      n/a
+ */
+void Jagged_set(Jagged_T jag, void *elem, int row, int col);
+
+/*
+ * Jagged_rows
+ *
+ * Returns the number of rows
+ *
+ * CREs         jag == NULL
+ * UREs         n/a
+ *
+ * @param       Jagged_T        Jagged to query
+ * @return      int             Number of rows
+ */
+int Jagged_rows(Jagged_T jag);
+
+/*
+ * Jagged_length
+ *
+ * Returns the number of values across all rows
+ *
+ * CREs         jag == NULL
+ * UREs         n/a
+ *
+ * @param       Jagged_T        Jagged to query
+ * @return      int64_t         Total number of values
+ */
+int64_t Jagged_length(Jagged_T jag);
+
+#endif
@@ -0,0 +1,173 @@
+/*
+ *      filename:       minmaxheap.h
+ *      author:         @keiferchiang
+ *      date:           18 Oct 2026
+ *      version:        0.0.1
+ *
+ *      description:    Interface for the MinMaxHeap module, a double-
+ *                      ended priority queue. Both the least and the
+ *                      greatest element are found in O(1), and either
+ *                      can be removed in O(log n), from a single heap
+ *                      stored in a Vector
+ *
+ *      usage:          MinMaxHeap_push(best, candidate);
+ *                      if (MinMaxHeap_length(best) > N)
+ *                              evicted = MinMaxHeap_pop_min(best);
+ */
+
+/*-------------------------------------
+ * C Preprocessor Directives
+ -------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <limits.h>
+#include <assert.h>
+
+#ifndef MINMAXHEAP_H_
+#define MINMAXHEAP_H_
+
+#include "iter.h"
+#include "vector.h"
+
+/*-------------------------------------
+ * Representation
+ -------------------------------------*/
+typedef struct minmaxheap_t *MinMaxHeap_T;
+
+/*-------------------------------------
+ * Function Prototypes
+ -------------------------------------*/
+/*
+ * MinMaxHeap_new
+ *
+ * Given a hint of the number of elements, creates and returns an
+ * empty MinMaxHeap ordered by cmp, which returns a negative, zero or
+ * positive value when a is less than, equal to or greater than b
+ *
+ * CREs         0 > hint >= INT_MAX
+ *              cmp == NULL
+ * UREs         cmp is not a consistent ordering
+ *
+ * @param       int             Hint of the number of elements
+ * @param       function        Compares two elements
+ * @param       void *          Closure passed to cmp
+ * @return      MinMaxHeap_T    An empty MinMaxHeap
+ */
+MinMaxHeap_T MinMaxHeap_new(int hint, int cmp(void *a, void *b, void *cl),
+                            void *cl);
+
+/*
+ * MinMaxHeap_free
+ *
+ * Recycles heap allocated memory for the MinMaxHeap. It is the
+ * client's responsibility to free the elements first
+ *
+ * CREs         heap == NULL
+ *              *heap == NULL
+ * UREs         n/a
+ *
+ * @param       MinMaxHeap_T *  Pointer to the MinMaxHeap
+ * @return      n/a
+ */
+void MinMaxHeap_free(MinMaxHeap_T *heap);
+
+/*
+ * MinMaxHeap_push
+ *
+ * Adds elem in O(log n)
+ *
+ * CREs         heap == NULL
+ * UREs         n/a
+ *
+ * @param       MinMaxHeap_T    MinMaxHeap to add to
+ * @param       void *          Element to add
+ * @return      n/a
+ */
+void MinMaxHeap_push(MinMaxHeap_T heap, void *elem);
+
+/*
+ * MinMaxHeap_min
+ *
+ * Returns the least element in O(1)
+ *
+ * CREs         heap == NULL
+ *              MinMaxHeap_length(heap) == 0
+ * UREs         n/a
+ *
+ * @param       MinMaxHeap_T    MinMaxHeap to query
+ * @return      void *          Least element
+ */
+void *MinMaxHeap_min(MinMaxHeap_T heap);
+
+/*
+ * MinMaxHeap_max
+ *
+ * Returns the greatest element in O(1)
+ *
+ * CREs         heap == NULL
+ *              MinMaxHeap_length(heap) == 0
+ * UREs         n/a
+ *
+ * @param       MinMaxHeap_T    MinMaxHeap to query
+ * @return      void *          Greatest element
+ */
+void *MinMaxHeap_max(MinMaxHeap_T heap);
+
+/*
+ * MinMaxHeap_pop_min
+ *
+ * Removes and returns the least element in O(log n)
+ *
+ * CREs         heap == NULL
+ *              MinMaxHeap_length(heap) == 0
+ * UREs         n/a
+ *
+ * @param       MinMaxHeap_T    MinMaxHeap to remove from
+ * @return      void *          Least element
+ */
+void *MinMaxHeap_pop_min(MinMaxHeap_T heap);
+
+/*
+ * MinMaxHeap_pop_max
+ *
+ * Removes and returns the greatest element in O(log n)
+ *
+ * CREs         heap == NULL
+ *              MinMaxHeap_length(heap) == 0
+ * UREs         n/a
+ *
+ * @param       MinMaxHeap_T    MinMaxHeap to remove from
+ * @return      void *          Greatest element
+ */
+void *MinMaxHeap_pop_max(MinMaxHeap_T heap);
+
+/*
+ * MinMaxHeap_length
+ *
+ * Returns the number of elements held
+ *
+ * CREs         heap == NULL
+ * UREs         n/a
+ *
+ * @param       MinMaxHeap_T    MinMaxHeap to query
+ * @return      int             Number of elements
+ */
+int MinMaxHeap_length(MinMaxHeap_T heap);
+
+/*
+ * MinMaxHeap_iter
+ *
+ * Returns an iterator over the elements in heap order, which is
+ * neither ascending nor descending
+ *
+ * CREs         heap == NULL
+ * UREs         the MinMaxHeap changes while iterating
+ *
+ * @param       MinMaxHeap_T    MinMaxHeap to iterate
+ * @return      Iter_T          Iterator over the elements
+ */
+Iter_T MinMaxHeap_iter(MinMaxHeap_T heap);
+
+#endif
@@ -0,0 +1,98 @@
+/*
+ *      filename:       pool.h
+ *      author:         @keiferchiang
+ *      date:           18 Oct 2026
+ *      version:        0.0.1
+ *
+ *      description:    Interface for the Pool module, a size-class
+ *                      object allocator for small fixed-size objects
+ *                      such as container nodes. Each thread caches
+ *                      freed objects in magazines; full and empty
+ *                      magazines are exchanged between threads
+ *                      through a lock-free global depot
+ */
+
+/*-------------------------------------
+ * C Preprocessor Directives
+ -------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <limits.h>
+#include <assert.h>
+
+#ifndef POOL_H_
+#define POOL_H_
+
+/*
+ * Largest object size served from the pool. Larger requests go
+ * straight to malloc and free
+ */
+#define POOL_MAX_SIZE 256
+
+/*-------------------------------------
+ * Function Prototypes
+ -------------------------------------*/
+/*
+ * Pool_alloc
+ *
+ * Returns a pointer to size bytes of uninitialized memory, aligned
+ * as malloc would align it. The memory is taken from the calling
+ * thread's cache when possible
+ *
+ * CREs         n/a
+ * UREs         n/a
+ *
+ * @param       size_t          Size of the object in bytes
+ * @return      void *          Pointer to the object
+ */
+void *Pool_alloc(size_t size);
+
+/*
+ * Pool_free
+ *
+ * Returns an object obtained from Pool_alloc to the calling
+ * thread's cache. The object may be freed by a different thread
+ * than the one that allocated it
+ *
+ * CREs         ptr == NULL
+ * UREs         size differs from the size given to Pool_alloc
+ *              ptr not obtained from Pool_alloc
+ *
+ * @param       void *          Object to free
+ * @param       size_t          Size of the object in bytes
+ * @return      n/a
+ */
+void Pool_free(void *ptr, size_t size);
+
+/*
+ * Pool_flush
+ *
+ * Hands the calling thread's cached objects over to the global
+ * depot, where other threads can reuse them. Runs on its own when
+ * a thread that used the Pool exits through pthread_exit or by
+ * returning from its start routine
+ *
+ * CREs         n/a
+ * UREs         n/a
+ *
+ * @return      n/a
+ */
+void Pool_flush(void);
+
+/*
+ * Pool_trim
+ *
+ * Returns every object held by the global depot to the system
+ * allocator. Objects cached by threads are untouched; call
+ * Pool_flush first to include the calling thread's cache
+ *
+ * CREs         n/a
+ * UREs         n/a
+ *
+ * @return      n/a
+ */
+void Pool_trim(void);
+
+#endif
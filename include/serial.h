@@ -0,0 +1,223 @@
+/*
+ *      filename:       serial.h
+ *      author:         @keiferchiang
+ *      date:           18 Oct 2026
+ *      version:        0.0.1
+ *
+ *      description:    Interface for the Serial module, a streaming
+ *                      binary format for container contents. Elements
+ *                      are converted to bytes by a client-supplied
+ *                      codec and written in length-prefixed frames,
+ *                      each of which may be compressed with a fast
+ *                      LZ77 (LZ4-style) block compressor
+ *
+ *      format:         header  "CDS1" u8 version, u8 flags, u16 0
+ *                      frame   u32 count, u32 raw_len, u32 stored_len
+ *                              stored_len bytes of payload
+ *                      end     frame with count 0
+ *
+ *                      All integers are little endian. A payload is a
+ *                      sequence of (varint length, encoded element)
+ *                      pairs; it is compressed iff stored_len < raw_len
+ */
+
+/*-------------------------------------
+ * C Preprocessor Directives
+ -------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <limits.h>
+#include <assert.h>
+#include <sys/types.h>
+#include <sys/uio.h>
+
+#ifndef SERIAL_H_
+#define SERIAL_H_
+
+/*
+ * Most iovecs handed to a single writev by the container writev
+ * functions
+ */
+#ifdef IOV_MAX
+#define SERIAL_IOV_MAX  IOV_MAX
+#else
+#define SERIAL_IOV_MAX  1024
+#endif
+
+/*
+ * Returned by a codec's decode to reject a malformed encoding. A
+ * distinct address rather than NULL, so that value-typed codecs can
+ * still decode 0
+ */
+extern char Serial_bad_record;
+#define SERIAL_BAD_RECORD ((void *) &Serial_bad_record)
+
+/*-------------------------------------
+ * Representation
+ -------------------------------------*/
+/*
+ * Element codec
+ *
+ * encode       Writes the encoding of elem into buf if it fits in
+ *              size bytes, and returns the length of the encoding
+ *              either way. Returns a negative value on failure
+ * decode       Rebuilds an element from its length-byte encoding.
+ *              Returns SERIAL_BAD_RECORD if the encoding is malformed
+ * free         Optional. Releases a decoded element when a read
+ *              fails midway
+ * cl           Closure passed to each of the functions above
+ * compress     Compress frames when writing
+ */
+typedef struct serial_codec_t {
+        int (*encode)(void *elem, unsigned char *buf, int size, void *cl);
+        void *(*decode)(const unsigned char *buf, int length, void *cl);
+        void (*free)(void *elem, void *cl);
+        void *cl;
+        bool compress;
+} Serial_Codec_T;
+
+typedef struct serial_writer_t *Serial_Writer_T;
+typedef struct serial_reader_t *Serial_Reader_T;
+
+/*-------------------------------------
+ * Function Prototypes
+ -------------------------------------*/
+//////////////////////////////////
+//      Writer Functions        //
+//////////////////////////////////
+/*
+ * Serial_writer_new
+ *
+ * Writes a stream header to fp and returns a writer that frames
+ * elements into it
+ *
+ * CREs         fp == NULL
+ *              codec == NULL or codec->encode == NULL
+ * UREs         writing to fp while the writer is live
+ *
+ * @param       FILE *                  Stream to write to
+ * @param       const Serial_Codec_T *  Codec for the elements
+ * @return      Serial_Writer_T         A new writer
+ */
+Serial_Writer_T Serial_writer_new(FILE *fp, const Serial_Codec_T *codec);
+
+/*
+ * Serial_write
+ *
+ * Encodes elem into the current frame, writing the frame out once
+ * it is full. Returns false if this or any earlier write failed
+ *
+ * CREs         writer == NULL
+ * UREs         n/a
+ *
+ * @param       Serial_Writer_T Writer to append to
+ * @param       void *          Element to encode
+ * @return      bool            true on success
+ */
+bool Serial_write(Serial_Writer_T writer, void *elem);
+
+/*
+ * Serial_writer_free
+ *
+ * Writes out the last frame and the end-of-stream marker, flushes
+ * the stream and frees the writer. fp is left open. Returns false
+ * if any write through the writer failed
+ *
+ * CREs         writer == NULL
+ * UREs         n/a
+ *
+ * @param       Serial_Writer_T *       Writer to finish
+ * @return      bool                    true on success
+ */
+bool Serial_writer_free(Serial_Writer_T *writer);
+
+//////////////////////////////////
+//      Reader Functions        //
+//////////////////////////////////
+/*
+ * Serial_reader_new
+ *
+ * Reads the stream header from fp and returns a reader for the
+ * stream, or NULL if fp does not hold a stream in this format
+ *
+ * CREs         fp == NULL
+ *              codec == NULL or codec->decode == NULL
+ * UREs         reading from fp while the reader is live
+ *
+ * @param       FILE *                  Stream to read from
+ * @param       const Serial_Codec_T *  Codec for the elements
+ * @return      Serial_Reader_T         A new reader, or NULL
+ */
+Serial_Reader_T Serial_reader_new(FILE *fp, const Serial_Codec_T *codec);
+
+/*
+ * Serial_read
+ *
+ * Decodes the next element of the stream into *elem. Returns false
+ * at the end of the stream or on a read or format error, including
+ * a record the codec rejects; use Serial_reader_failed to tell them
+ * apart
+ *
+ * CREs         reader == NULL
+ *              elem == NULL
+ * UREs         n/a
+ *
+ * @param       Serial_Reader_T Reader to read from
+ * @param       void **         Location of the decoded element
+ * @return      bool            true if an element was read
+ */
+bool Serial_read(Serial_Reader_T reader, void **elem);
+
+/*
+ * Serial_reader_failed
+ *
+ * Returns true if the reader stopped on an error rather than at
+ * the end of the stream
+ *
+ * CREs         reader == NULL
+ * UREs         n/a
+ *
+ * @param       Serial_Reader_T Reader to query
+ * @return      bool            true on error
+ */
+bool Serial_reader_failed(Serial_Reader_T reader);
+
+/*
+ * Serial_reader_free
+ *
+ * Frees the reader. fp is left open, positioned after the last
+ * frame read
+ *
+ * CREs         reader == NULL
+ * UREs         n/a
+ *
+ * @param       Serial_Reader_T *       Reader to free
+ * @return      n/a
+ */
+void Serial_reader_free(Serial_Reader_T *reader);
+
+//////////////////////////////////
+//      Gather Functions        //
+//////////////////////////////////
+/*
+ * Serial_writev
+ *
+ * Writes every byte described by the iovcnt buffers of iov to fd,
+ * resuming after partial writes and interrupted calls. iov is
+ * consumed: on return its entries no longer describe the original
+ * buffers. Returns the number of bytes written, or -1 on error
+ *
+ * CREs         iov == NULL and iovcnt > 0
+ *              0 > iovcnt > SERIAL_IOV_MAX
+ * UREs         n/a
+ *
+ * @param       int             File descriptor to write to
+ * @param       struct iovec *  Buffers to write, in order
+ * @param       int             Number of buffers
+ * @return      ssize_t         Bytes written, or -1
+ */
+ssize_t Serial_writev(int fd, struct iovec *iov, int iovcnt);
+
+#endif
@@ -0,0 +1,182 @@
+/*
+ *      filename:       skiplist.h
+ *      author:         @keiferchiang
+ *      date:           18 Oct 2026
+ *      version:        0.0.1
+ *
+ *      description:    Interface for the SkipList module, an ordered
+ *                      map that many threads can update and scan at
+ *                      once without locks. Inserts and removals use
+ *                      compare-and-swap, lookups only read, and removed
+ *                      nodes are freed through epoch-based reclamation
+ *                      once no thread can still be looking at them
+ *
+ *      note:           Built on the GCC/Clang __atomic builtins. Every
+ *                      thread that used a SkipList should call
+ *                      SkipList_thread_free before exiting
+ *
+ *      usage:          SkipList_T index = SkipList_new(by_key, NULL);
+ *                      (from any thread)
+ *                      SkipList_insert(index, key, row);
+ *                      SkipList_range(index, lo, hi, visit, cl);
+ */
+
+/*-------------------------------------
+ * C Preprocessor Directives
+ -------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <limits.h>
+#include <assert.h>
+
+#ifndef SKIPLIST_H_
+#define SKIPLIST_H_
+
+/*-------------------------------------
+ * Representation
+ -------------------------------------*/
+typedef struct skiplist_t *SkipList_T;
+
+/*-------------------------------------
+ * Function Prototypes
+ -------------------------------------*/
+/*
+ * SkipList_new
+ *
+ * Creates and returns an empty SkipList whose keys are ordered by
+ * cmp, which returns a negative, zero or positive value when a is
+ * less than, equal to or greater than b. cmp is called from several
+ * threads at once
+ *
+ * CREs         cmp == NULL
+ * UREs         cmp is not a consistent ordering
+ *              cmp is not thread safe
+ *
+ * @param       function        Compares two keys
+ * @param       void *          Closure passed to cmp
+ * @return      SkipList_T      An empty SkipList
+ */
+SkipList_T SkipList_new(int cmp(void *a, void *b, void *cl), void *cl);
+
+/*
+ * SkipList_free
+ *
+ * Recycles heap allocated memory for the SkipList. It is the
+ * client's responsibility to free the keys and values first.
+ * Nodes removed shortly before are still waiting for reclamation
+ * and are freed later, by the threads that removed them, or when
+ * those threads call SkipList_thread_free
+ *
+ * CREs         list == NULL
+ *              *list == NULL
+ * UREs         other threads still using the SkipList
+ *
+ * @param       SkipList_T *    Pointer to the SkipList
+ * @return      n/a
+ */
+void SkipList_free(SkipList_T *list);
+
+/*
+ * SkipList_insert
+ *
+ * Maps key to value if key is not already present, in O(log n)
+ * expected. Returns false, changing nothing, if it is. Thread safe
+ *
+ * CREs         list == NULL
+ * UREs         n/a
+ *
+ * @param       SkipList_T      SkipList to insert into
+ * @param       void *          Key
+ * @param       void *          Value
+ * @return      bool            true if key was added
+ */
+bool SkipList_insert(SkipList_T list, void *key, void *value);
+
+/*
+ * SkipList_remove
+ *
+ * Removes key, storing its value in *value when value is not NULL.
+ * Returns false if key is not present. Thread safe
+ *
+ * CREs         list == NULL
+ * UREs         freeing the key while other threads may compare it
+ *
+ * @param       SkipList_T      SkipList to remove from
+ * @param       void *          Key
+ * @param       void **         Location for the value, or NULL
+ * @return      bool            true if key was removed
+ */
+bool SkipList_remove(SkipList_T list, void *key, void **value);
+
+/*
+ * SkipList_get
+ *
+ * Looks key up, storing its value in *value when value is not NULL.
+ * Lookups never write to the SkipList and never retry. Thread safe
+ *
+ * CREs         list == NULL
+ * UREs         n/a
+ *
+ * @param       SkipList_T      SkipList to query
+ * @param       void *          Key
+ * @param       void **         Location for the value, or NULL
+ * @return      bool            true if key is present
+ */
+bool SkipList_get(SkipList_T list, void *key, void **value);
+
+/*
+ * SkipList_range
+ *
+ * Calls visit on each key in [lo, hi) in ascending order, with its
+ * value, until visit returns false. A NULL lo starts at the least
+ * key and a NULL hi runs to the greatest. Keys inserted or removed
+ * during the scan may or may not be visited; every other key in
+ * range is visited exactly once. Thread safe
+ *
+ * CREs         list == NULL
+ *              visit == NULL
+ * UREs         n/a
+ *
+ * @param       SkipList_T      SkipList to scan
+ * @param       void *          Least key to visit, or NULL
+ * @param       void *          Key to stop before, or NULL
+ * @param       function        Called per key; false stops the scan
+ * @param       void *          Closure passed to visit
+ * @return      int             Number of keys visited
+ */
+int SkipList_range(SkipList_T list, void *lo, void *hi,
+                   bool visit(void *key, void *value, void *cl), void *cl);
+
+/*
+ * SkipList_length
+ *
+ * Returns the number of keys. With other threads updating, the
+ * count is only approximate. Thread safe
+ *
+ * CREs         list == NULL
+ * UREs         n/a
+ *
+ * @param       SkipList_T      SkipList to query
+ * @return      int             Number of keys
+ */
+int SkipList_length(SkipList_T list);
+
+/*
+ * SkipList_thread_free
+ *
+ * Releases the calling thread's reclamation record, first freeing
+ * the nodes it removed that no other thread can still be reading.
+ * Any it cannot free yet, because other threads are mid-operation,
+ * are handed on to the next thread to use a SkipList. Threads that
+ * used a SkipList should call this before exiting
+ *
+ * CREs         n/a
+ * UREs         called from inside a SkipList_range callback
+ *
+ * @return      n/a
+ */
+void SkipList_thread_free(void);
+
+#endif
@@ -0,0 +1,200 @@
+/*
+ *      filename:       slotmap.h
+ *      author:         @keiferchiang
+ *      date:           18 Oct 2026
+ *      version:        0.0.1
+ *
+ *      description:    Interface for the SlotMap module, an object
+ *                      registry handing out stable 64-bit handles.
+ *                      Elements are stored densely in a Vector for
+ *                      fast iteration; a handle names a slot that
+ *                      tracks where its element currently sits, and
+ *                      carries the slot's generation so handles to
+ *                      removed elements are detected rather than
+ *                      silently reused
+ *
+ *      usage:          uint64_t id = SlotMap_insert(map, obj);
+ *                      ...
+ *                      if (SlotMap_contains(map, id))
+ *                              obj = SlotMap_get(map, id);
+ */
+
+/*-------------------------------------
+ * C Preprocessor Directives
+ -------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <limits.h>
+#include <assert.h>
+#include <stdint.h>
+
+#ifndef SLOTMAP_H_
+#define SLOTMAP_H_
+
+#include "iter.h"
+#include "vector.h"
+
+/*
+ * Never returned by SlotMap_insert, so usable as a null handle
+ */
+#define SLOTMAP_NIL     ((uint64_t) 0)
+
+/*-------------------------------------
+ * Representation
+ -------------------------------------*/
+typedef struct slotmap_t *SlotMap_T;
+
+/*-------------------------------------
+ * Function Prototypes
+ -------------------------------------*/
+/*
+ * SlotMap_new
+ *
+ * Given a hint of the number of elements, creates and returns an
+ * empty SlotMap
+ *
+ * CREs         0 > hint >= INT_MAX
+ * UREs         n/a
+ *
+ * @param       int             Hint of the number of elements
+ * @return      SlotMap_T       An empty SlotMap
+ */
+SlotMap_T SlotMap_new(int hint);
+
+/*
+ * SlotMap_free
+ *
+ * Recycles heap allocated memory for the SlotMap. It is the
+ * client's responsibility to free the elements first
+ *
+ * CREs         map == NULL
+ *              *map == NULL
+ * UREs         n/a
+ *
+ * @param       SlotMap_T *     Pointer to the SlotMap
+ * @return      n/a
+ */
+void SlotMap_free(SlotMap_T *map);
+
+/*
+ * SlotMap_insert
+ *
+ * Stores elem and returns its handle, in O(1) amortized
+ *
+ * CREs         map == NULL
+ *              more than UINT32_MAX - 1 slots
+ * UREs         n/a
+ *
+ * @param       SlotMap_T       SlotMap to insert into
+ * @param       void *          Element to store
+ * @return      uint64_t        Handle of the element
+ */
+uint64_t SlotMap_insert(SlotMap_T map, void *elem);
+
+/*
+ * SlotMap_contains
+ *
+ * Returns true if handle names an element still in the SlotMap.
+ * Handles of removed elements are recognized as stale until their
+ * slot has been reused 2^32 times
+ *
+ * CREs         map == NULL
+ * UREs         n/a
+ *
+ * @param       SlotMap_T       SlotMap to query
+ * @param       uint64_t        Handle to check
+ * @return      bool            true if the handle is live
+ */
+bool SlotMap_contains(SlotMap_T map, uint64_t handle);
+
+/*
+ * SlotMap_get
+ *
+ * Returns the element named by handle in O(1), or NULL if the
+ * handle is stale
+ *
+ * CREs         map == NULL
+ * UREs         n/a
+ *
+ * @param       SlotMap_T       SlotMap to query
+ * @param       uint64_t        Handle of the element
+ * @return      void *          The element, or NULL
+ */
+void *SlotMap_get(SlotMap_T map, uint64_t handle);
+
+/*
+ * SlotMap_remove
+ *
+ * Removes the element named by handle in O(1), storing it in *elem
+ * when elem is not NULL. The last dense element moves into its
+ * place. Returns false, changing nothing, if the handle is stale
+ *
+ * CREs         map == NULL
+ * UREs         n/a
+ *
+ * @param       SlotMap_T       SlotMap to remove from
+ * @param       uint64_t        Handle of the element
+ * @param       void **         Location for the element, or NULL
+ * @return      bool            true if an element was removed
+ */
+bool SlotMap_remove(SlotMap_T map, uint64_t handle, void **elem);
+
+/*
+ * SlotMap_length
+ *
+ * Returns the number of elements stored
+ *
+ * CREs         map == NULL
+ * UREs         n/a
+ *
+ * @param       SlotMap_T       SlotMap to query
+ * @return      int             Number of elements
+ */
+int SlotMap_length(SlotMap_T map);
+
+/*
+ * SlotMap_handle
+ *
+ * Returns the handle of the element at the given dense index, for
+ * walking elements and handles together
+ *
+ * CREs         map == NULL
+ *              index out of bounds
+ * UREs         n/a
+ *
+ * @param       SlotMap_T       SlotMap to query
+ * @param       int             Dense index in [0, length)
+ * @return      uint64_t        Handle of the element there
+ */
+uint64_t SlotMap_handle(SlotMap_T map, int index);
+
+/*
+ * SlotMap_values
+ *
+ * Returns the dense Vector of elements, in no particular order.
+ * Elements may be read and replaced in place
+ *
+ * CREs         map == NULL
+ * UREs         changing the length of the returned Vector
+ *
+ * @param       SlotMap_T       SlotMap to query
+ * @return      Vector_T        The SlotMap's element storage
+ */
+Vector_T SlotMap_values(SlotMap_T map);
+
+/*
+ * SlotMap_iter
+ *
+ * Returns an iterator over the elements, walking the dense storage
+ *
+ * CREs         map == NULL
+ * UREs         inserting or removing while iterating
+ *
+ * @param       SlotMap_T       SlotMap to iterate
+ * @return      Iter_T          Iterator over the elements
+ */
+Iter_T SlotMap_iter(SlotMap_T map);
+
+#endif
@@ -0,0 +1,202 @@
+/*
+ *      filename:       sparseset.h
+ *      author:         @keiferchiang
+ *      date:           18 Oct 2026
+ *      version:        0.0.1
+ *
+ *      description:    Interface for the SparseSet module, a set of
+ *                      integer IDs drawn from a fixed universe
+ *                      [0, universe). Insert, remove, membership and
+ *                      clear are all O(1), and members are stored
+ *                      densely so iterating costs O(length) however
+ *                      large the universe is
+ *
+ *      usage:          SparseSet_T active = SparseSet_new(1 << 20);
+ *                      for each tick:
+ *                              SparseSet_clear(active);
+ *                              SparseSet_insert(active, id);
+ *                              ...
+ */
+
+/*-------------------------------------
+ * C Preprocessor Directives
+ -------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <limits.h>
+#include <assert.h>
+
+#ifndef SPARSESET_H_
+#define SPARSESET_H_
+
+#include "iter.h"
+#include "vector.h"
+
+/*-------------------------------------
+ * Representation
+ -------------------------------------*/
+typedef struct sparseset_t *SparseSet_T;
+
+/*-------------------------------------
+ * Function Prototypes
+ -------------------------------------*/
+/*
+ * SparseSet_new
+ *
+ * Creates and returns an empty SparseSet over the IDs
+ * [0, universe)
+ *
+ * CREs         0 > universe >= INT_MAX
+ * UREs         n/a
+ *
+ * @param       int             Number of possible IDs
+ * @return      SparseSet_T     An empty SparseSet
+ */
+SparseSet_T SparseSet_new(int universe);
+
+/*
+ * SparseSet_free
+ *
+ * Recycles heap allocated memory for the SparseSet
+ *
+ * CREs         set == NULL
+ *              *set == NULL
+ * UREs         n/a
+ *
+ * @param       SparseSet_T *   Pointer to the SparseSet
+ * @return      n/a
+ */
+void SparseSet_free(SparseSet_T *set);
+
+/*
+ * SparseSet_insert
+ *
+ * Adds id to the SparseSet. Returns false if it was already a
+ * member
+ *
+ * CREs         set == NULL
+ *              0 > id >= universe
+ * UREs         n/a
+ *
+ * @param       SparseSet_T     SparseSet to insert into
+ * @param       int             ID to add
+ * @return      bool            true if id was added
+ */
+bool SparseSet_insert(SparseSet_T set, int id);
+
+/*
+ * SparseSet_remove
+ *
+ * Removes id from the SparseSet. The last dense member moves into
+ * its place. Returns false if it was not a member
+ *
+ * CREs         set == NULL
+ *              0 > id >= universe
+ * UREs         n/a
+ *
+ * @param       SparseSet_T     SparseSet to remove from
+ * @param       int             ID to remove
+ * @return      bool            true if id was removed
+ */
+bool SparseSet_remove(SparseSet_T set, int id);
+
+/*
+ * SparseSet_contains
+ *
+ * Returns true if id is a member of the SparseSet
+ *
+ * CREs         set == NULL
+ *              0 > id >= universe
+ * UREs         n/a
+ *
+ * @param       SparseSet_T     SparseSet to query
+ * @param       int             ID to look up
+ * @return      bool            true if id is a member
+ */
+bool SparseSet_contains(SparseSet_T set, int id);
+
+/*
+ * SparseSet_clear
+ *
+ * Removes every member in O(1), without touching the sparse index
+ *
+ * CREs         set == NULL
+ * UREs         n/a
+ *
+ * @param       SparseSet_T     SparseSet to clear
+ * @return      n/a
+ */
+void SparseSet_clear(SparseSet_T set);
+
+/*
+ * SparseSet_length
+ *
+ * Returns the number of members
+ *
+ * CREs         set == NULL
+ * UREs         n/a
+ *
+ * @param       SparseSet_T     SparseSet to query
+ * @return      int             Number of members
+ */
+int SparseSet_length(SparseSet_T set);
+
+/*
+ * SparseSet_universe
+ *
+ * Returns the number of possible IDs the SparseSet was created with
+ *
+ * CREs         set == NULL
+ * UREs         n/a
+ *
+ * @param       SparseSet_T     SparseSet to query
+ * @return      int             Size of the ID universe
+ */
+int SparseSet_universe(SparseSet_T set);
+
+/*
+ * SparseSet_get
+ *
+ * Returns the member at the given dense index. Members are in
+ * insertion order until the first removal
+ *
+ * CREs         set == NULL
+ *              index out of bounds
+ * UREs         n/a
+ *
+ * @param       SparseSet_T     SparseSet to query
+ * @param       int             Dense index in [0, length)
+ * @return      int             The member there
+ */
+int SparseSet_get(SparseSet_T set, int index);
+
+/*
+ * SparseSet_values
+ *
+ * Returns the dense value-typed Vector of members, read with
+ * Vector_toint
+ *
+ * CREs         set == NULL
+ * UREs         modifying the returned Vector
+ *
+ * @param       SparseSet_T     SparseSet to query
+ * @return      Vector_T        The SparseSet's member storage
+ */
+Vector_T SparseSet_values(SparseSet_T set);
+
+/*
+ * SparseSet_iter
+ *
+ * Returns an iterator over the members, yielding Vector_int values
+ *
+ * CREs         set == NULL
+ * UREs         inserting or removing while iterating
+ *
+ * @param       SparseSet_T     SparseSet to iterate
+ * @return      Iter_T          Iterator over the members
+ */
+Iter_T SparseSet_iter(SparseSet_T set);
+
+#endif
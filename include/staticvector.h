@@ -0,0 +1,301 @@
+/*
+ *      filename:       staticvector.h
+ *      author:         @keiferchiang
+ *      date:           18 Oct 2026
+ *      version:        0.0.1
+ *
+ *      description:    Header-only StaticVector, a Vector with a
+ *                      capacity fixed at compile time. Its storage is
+ *                      an inline array, so it lives wherever it is
+ *                      declared (on the stack or inside a parent
+ *                      struct) and never touches the heap. The API
+ *                      mirrors vector.h; bounds checks are asserts,
+ *                      compiled out with NDEBUG
+ *
+ *      note:           The operations are macros over any struct with
+ *                      an int size and a void *array[capacity], so
+ *                      StaticVector_T(n) can be used as an anonymous
+ *                      member type. Each macro evaluates sv more than
+ *                      once; every other argument exactly once
+ *
+ *      usage:          StaticVector_T(8) args;
+ *
+ *                      StaticVector_init(&args);
+ *                      StaticVector_append(&args, token);
+ *                      first = StaticVector_get(&args, 0);
+ */
+
+/*-------------------------------------
+ * C Preprocessor Directives
+ -------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <limits.h>
+#include <assert.h>
+
+#ifndef STATICVECTOR_H_
+#define STATICVECTOR_H_
+
+#include "iter.h"
+
+/*-------------------------------------
+ * Representation
+ -------------------------------------*/
+/*
+ * StaticVector_T
+ *
+ * Type of a StaticVector holding up to capacity elements
+ *
+ * CREs         capacity is not a positive integer constant
+ * UREs         n/a
+ */
+#define StaticVector_T(capacity)                                        \
+        struct {                                                        \
+                int size;                                               \
+                void *array[capacity];                                  \
+        }
+
+/*-------------------------------------
+ * Function Prototypes
+ -------------------------------------*/
+/*
+ * StaticVector_init
+ *
+ * Empties the StaticVector. Must be called before first use; only
+ * the length is written, so it is O(1) whatever the capacity
+ *
+ * CREs         n/a
+ * UREs         sv == NULL
+ *
+ * @param       StaticVector_T *        StaticVector to empty
+ * @return      n/a
+ */
+#define StaticVector_init(sv)   ((void) ((sv)->size = 0))
+
+/*
+ * StaticVector_capacity
+ *
+ * Returns the capacity as an int constant expression
+ *
+ * CREs         n/a
+ * UREs         n/a
+ *
+ * @param       StaticVector_T *        StaticVector to query
+ * @return      int                     Maximum number of elements
+ */
+#define StaticVector_capacity(sv)                                       \
+        ((int) (sizeof((sv)->array) / sizeof((sv)->array[0])))
+
+/*
+ * StaticVector_length
+ *
+ * Returns the number of elements
+ *
+ * CREs         n/a
+ * UREs         sv == NULL
+ *
+ * @param       StaticVector_T *        StaticVector to query
+ * @return      int                     Number of elements
+ */
+#define StaticVector_length(sv)         ((sv)->size)
+
+/*
+ * StaticVector_full
+ *
+ * Returns true if no more elements can be appended
+ *
+ * CREs         n/a
+ * UREs         sv == NULL
+ *
+ * @param       StaticVector_T *        StaticVector to query
+ * @return      bool                    true if length == capacity
+ */
+#define StaticVector_full(sv)                                           \
+        ((sv)->size == StaticVector_capacity(sv))
+
+/*
+ * StaticVector_data
+ *
+ * Returns the underlying array, valid for StaticVector_length slots
+ *
+ * CREs         n/a
+ * UREs         sv == NULL
+ *
+ * @param       StaticVector_T *        StaticVector to query
+ * @return      void **                 The element array
+ */
+#define StaticVector_data(sv)           ((sv)->array)
+
+/*
+ * StaticVector_get
+ *
+ * Returns the element at index
+ *
+ * CREs         index out of bounds
+ * UREs         sv == NULL
+ *
+ * @param       StaticVector_T *        StaticVector to query
+ * @param       int                     Index of the element
+ * @return      void *                  The element
+ */
+#define StaticVector_get(sv, index)                                     \
+        staticvector_get((sv)->array, (sv)->size, (index))
+
+/*
+ * StaticVector_last
+ *
+ * Returns the last element
+ *
+ * CREs         StaticVector is empty
+ * UREs         sv == NULL
+ *
+ * @param       StaticVector_T *        StaticVector to query
+ * @return      void *                  The last element
+ */
+#define StaticVector_last(sv)                                           \
+        staticvector_get((sv)->array, (sv)->size, (sv)->size - 1)
+
+/*
+ * StaticVector_set
+ *
+ * Replaces the element at index. As with Vector_set, an index equal
+ * to the length appends
+ *
+ * CREs         0 > index > length
+ *              index == length and the StaticVector is full
+ * UREs         sv == NULL
+ *
+ * @param       StaticVector_T *        StaticVector to modify
+ * @param       void *                  New element
+ * @param       int                     Index of the element
+ * @return      n/a
+ */
+#define StaticVector_set(sv, elem, index)                               \
+        staticvector_set((sv)->array, &(sv)->size,                      \
+                         StaticVector_capacity(sv), (elem), (index))
+
+/*
+ * StaticVector_append
+ *
+ * Adds elem after the last element
+ *
+ * CREs         StaticVector is full
+ * UREs         sv == NULL
+ *
+ * @param       StaticVector_T *        StaticVector to extend
+ * @param       void *                  Element to append
+ * @return      n/a
+ */
+#define StaticVector_append(sv, elem)                                   \
+        staticvector_set((sv)->array, &(sv)->size,                      \
+                         StaticVector_capacity(sv), (elem), (sv)->size)
+
+/*
+ * StaticVector_remove
+ *
+ * Removes the element at index, shifting later elements down
+ *
+ * CREs         index out of bounds
+ * UREs         sv == NULL
+ *
+ * @param       StaticVector_T *        StaticVector to modify
+ * @param       int                     Index of the element
+ * @return      n/a
+ */
+#define StaticVector_remove(sv, index)                                  \
+        staticvector_remove((sv)->array, &(sv)->size, (index))
+
+/*
+ * StaticVector_swap_remove
+ *
+ * Removes the element at index in O(1) by moving the last element
+ * into its place
+ *
+ * CREs         index out of bounds
+ * UREs         sv == NULL
+ *
+ * @param       StaticVector_T *        StaticVector to modify
+ * @param       int                     Index of the element
+ * @return      n/a
+ */
+#define StaticVector_swap_remove(sv, index)                             \
+        staticvector_swap_remove((sv)->array, &(sv)->size, (index))
+
+/*
+ * StaticVector_removehi
+ *
+ * Removes the last element
+ *
+ * CREs         StaticVector is empty
+ * UREs         sv == NULL
+ *
+ * @param       StaticVector_T *        StaticVector to modify
+ * @return      n/a
+ */
+#define StaticVector_removehi(sv)                                       \
+        staticvector_swap_remove((sv)->array, &(sv)->size, (sv)->size - 1)
+
+/*
+ * StaticVector_iter
+ *
+ * Returns an iterator over the elements
+ *
+ * CREs         n/a
+ * UREs         sv == NULL
+ *              the StaticVector changes while iterating
+ *
+ * @param       StaticVector_T *        StaticVector to iterate
+ * @return      Iter_T                  Iterator over the elements
+ */
+#define StaticVector_iter(sv)   Iter_array((sv)->array, (sv)->size)
+
+/*-------------------------------------
+ * Helper/Private Definitions
+ -------------------------------------*/
+/*
+ * The macros above pass the array, length and capacity here so that
+ * their arguments are evaluated once and the checks live in one place
+ */
+static inline void *staticvector_get(void **array, int size, int index)
+{
+        assert(index >= 0 && index < size);
+        (void) size;
+
+        return array[index];
+}
+
+static inline void staticvector_set(void **array, int *size, int capacity,
+                                    void *elem, int index)
+{
+        assert(index >= 0 && index <= *size);
+
+        if (index == *size) {
+                assert(*size < capacity);
+                (*size)++;
+        }
+        (void) capacity;
+
+        array[index] = elem;
+}
+
+static inline void staticvector_remove(void **array, int *size, int index)
+{
+        assert(index >= 0 && index < *size);
+
+        (*size)--;
+        memmove(array + index, array + index + 1,
+                (*size - index) * sizeof(void *));
+}
+
+static inline void staticvector_swap_remove(void **array, int *size,
+                                            int index)
+{
+        assert(index >= 0 && index < *size);
+
+        (*size)--;
+        array[index] = array[*size];
+}
+
+#endif
@@ -0,0 +1,182 @@
+/*
+ *      filename:       topk.h
+ *      author:         @keiferchiang
+ *      date:           18 Oct 2026
+ *      version:        0.0.1
+ *
+ *      description:    Interface for the TopK module, a streaming
+ *                      accumulator keeping the k greatest elements it
+ *                      has been fed. Accumulators filled on separate
+ *                      shards of the input can be merged
+ *
+ *      usage:          TopK_T top = TopK_new(100, by_score, NULL);
+ *                      TopK_push_vector(top, candidates);
+ *                      best = TopK_vector(top);
+ */
+
+/*-------------------------------------
+ * C Preprocessor Directives
+ -------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <limits.h>
+#include <assert.h>
+
+#ifndef TOPK_H_
+#define TOPK_H_
+
+#include "iter.h"
+#include "vector.h"
+
+/*-------------------------------------
+ * Representation
+ -------------------------------------*/
+typedef struct topk_t *TopK_T;
+
+/*-------------------------------------
+ * Function Prototypes
+ -------------------------------------*/
+/*
+ * TopK_new
+ *
+ * Creates an empty accumulator keeping the k greatest elements
+ * under cmp, which returns a negative, zero or positive value when
+ * a is less than, equal to or greater than b
+ *
+ * CREs         k <= 0
+ *              cmp == NULL
+ * UREs         cmp is not a consistent ordering
+ *
+ * @param       int             Number of elements to keep
+ * @param       function        Compares two elements
+ * @param       void *          Closure passed to cmp
+ * @return      TopK_T          An empty accumulator
+ */
+TopK_T TopK_new(int k, int cmp(void *a, void *b, void *cl), void *cl);
+
+/*
+ * TopK_free
+ *
+ * Recycles heap allocated memory for the accumulator. The elements
+ * it holds are the client's
+ *
+ * CREs         top == NULL
+ *              *top == NULL
+ * UREs         n/a
+ *
+ * @param       TopK_T *        Pointer to the accumulator
+ * @return      n/a
+ */
+void TopK_free(TopK_T *top);
+
+/*
+ * TopK_push
+ *
+ * Offers an element to the accumulator. Once k elements are held,
+ * an element no greater than the least of them is rejected with a
+ * single comparison; otherwise it replaces that least element in
+ * O(log k)
+ *
+ * CREs         top == NULL
+ * UREs         n/a
+ *
+ * @param       TopK_T          Accumulator
+ * @param       void *          Element to offer
+ * @return      bool            True if the element was kept
+ */
+bool TopK_push(TopK_T top, void *elem);
+
+/*
+ * TopK_push_iter
+ *
+ * Offers every remaining element of an iterator, draining it
+ *
+ * CREs         top == NULL
+ *              iter == NULL
+ * UREs         n/a
+ *
+ * @param       TopK_T          Accumulator
+ * @param       Iter_T *        Iterator to drain
+ * @return      n/a
+ */
+void TopK_push_iter(TopK_T top, Iter_T *iter);
+
+/*
+ * TopK_push_vector
+ *
+ * Offers every element of a Vector, in index order
+ *
+ * CREs         top == NULL
+ *              vec == NULL
+ * UREs         n/a
+ *
+ * @param       TopK_T          Accumulator
+ * @param       Vector_T        Vector to read
+ * @return      n/a
+ */
+void TopK_push_vector(TopK_T top, Vector_T vec);
+
+/*
+ * TopK_merge
+ *
+ * Offers every element held by src to dst, so dst ends up with the
+ * k greatest of both. Accumulators filled on separate shards of an
+ * input merge into the result for the whole input. src is left
+ * unchanged
+ *
+ * CREs         dst == NULL
+ *              src == NULL
+ * UREs         src and dst order elements differently
+ *
+ * @param       TopK_T          Accumulator to merge into
+ * @param       TopK_T          Accumulator to merge from
+ * @return      n/a
+ */
+void TopK_merge(TopK_T dst, TopK_T src);
+
+/*
+ * TopK_length
+ *
+ * Returns the number of elements held, at most k
+ *
+ * CREs         top == NULL
+ * UREs         n/a
+ *
+ * @param       TopK_T          Accumulator
+ * @return      int             Number of elements held
+ */
+int TopK_length(TopK_T top);
+
+/*
+ * TopK_min
+ *
+ * Returns the least element held. Once the accumulator is full,
+ * only elements greater than this one can still enter, so callers
+ * may use it to skip candidates early
+ *
+ * CREs         top == NULL
+ *              TopK_length(top) == 0
+ * UREs         n/a
+ *
+ * @param       TopK_T          Accumulator
+ * @return      void *          Least element held
+ */
+void *TopK_min(TopK_T top);
+
+/*
+ * TopK_vector
+ *
+ * Returns a new Vector of the elements held, greatest first. The
+ * accumulator is left unchanged
+ *
+ * CREs         top == NULL
+ * UREs         n/a
+ *
+ * @param       TopK_T          Accumulator
+ * @return      Vector_T        Elements in descending order
+ */
+Vector_T TopK_vector(TopK_T top);
+
+#endif
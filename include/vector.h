@@ -16,15 +16,29 @@
 #include <string.h>
 #include <limits.h>
 #include <assert.h>
+#include <stdint.h>
 
 #ifndef VECTOR_H_
 #define VECTOR_H_
 
+#include "arena.h"
+#include "iter.h"
+#include "serial.h"
+
 /*-------------------------------------
  * Representation
  -------------------------------------*/
 typedef struct vector_t *Vector_T;
 
+/*
+ * Value-typed Vectors store integers in the element slots
+ * themselves rather than pointers to them. These convert between
+ * the two; the scan, sort and set functions on value-typed Vectors
+ * read slots as intptr_t
+ */
+#define Vector_int(n)   ((void *) (intptr_t) (n))
+#define Vector_toint(p) ((intptr_t) (p))
+
 /*-------------------------------------
  * Function Prototypes
  -------------------------------------*/
@@ -44,12 +58,32 @@ typedef struct vector_t *Vector_T;
  */
 Vector_T Vector_new(int hint);
 
+/*
+ * Vector_new_arena
+ *
+ * Same as Vector_new, but the Vector and its backing array are
+ * allocated from the given Arena. Such a Vector needs no
+ * Vector_free; resetting or freeing the Arena reclaims it
+ *
+ * CREs         0 > hint >= INT_MAX
+ *              arena == NULL
+ * UREs         using the Vector after its Arena is reset
+ *
+ * @param       int             Hint of the default size of
+ * 				the Vector
+ * @param       Arena_T         Arena to allocate from
+ * @return      Vector_T        A pointer to an instance of
+ * 				an expandable array
+ */
+Vector_T Vector_new_arena(int hint, Arena_T arena);
+
 /*
  * Vector_free
  *
  * Recycles heap allocated memory for Vector. It is the client's
  * responsibility to free every element in the Vector before
- * freeing the Vector itself
+ * freeing the Vector itself. Arena-backed Vectors are left to
+ * their Arena
  *
  * CREs         vec == NULL
  * UREs         elements in vec != NULL
@@ -59,6 +93,45 @@ Vector_T Vector_new(int hint);
  */
 void Vector_free(Vector_T *vec);
 
+//////////////////////////////////
+//      Ownership Functions     //
+//////////////////////////////////
+/*
+ * Vector_own
+ *
+ * Hands ownership of the Vector's elements to the Vector.
+ * Vector_clear then destroys them with free_batch, called once on
+ * the whole backing array, or else with free_elem, called once per
+ * non-NULL element. Passing NULL for both restores the default,
+ * which is to release elements with free
+ *
+ * CREs         vec == NULL
+ * UREs         n/a
+ *
+ * @param       Vector_T        Vector owning the elements
+ * @param       function        Destroys a single element
+ * @param       function        Destroys an array of elements
+ * @param       void *          Closure passed to either function
+ * @return      n/a
+ */
+void Vector_own(Vector_T vec, void free_elem(void *elem, void *cl),
+                void free_batch(void **elems, int length, void *cl),
+                void *cl);
+
+/*
+ * Vector_clear
+ *
+ * Destroys every element in the Vector as set up by Vector_own
+ * in a single pass, then frees the Vector itself
+ *
+ * CREs         vec == NULL
+ * UREs         elements not owned by the Vector
+ *
+ * @param       Vector_T *      Vector to be cleared and freed
+ * @return      n/a
+ */
+void Vector_clear(Vector_T *vec);
+
 //////////////////////////////////
 //      Getter Functions        //
 //////////////////////////////////
@@ -76,6 +149,21 @@ void Vector_free(Vector_T *vec);
  */
 int Vector_length(Vector_T vec);
 
+/*
+ * Vector_data
+ *
+ * Returns the Vector's backing array, whose first Vector_length
+ * slots are the elements in order. The array is valid until the
+ * Vector next grows
+ *
+ * CREs         vec == NULL
+ * UREs         using the array after the Vector grows or is freed
+ *
+ * @param       Vector_T        Vector whose slots are returned
+ * @return      void **         First slot of the Vector
+ */
+void **Vector_data(Vector_T vec);
+
 /*
  * Vector_get
  *
@@ -144,6 +232,22 @@ void *Vector_first(Vector_T vec);
  */
 void Vector_set(Vector_T vec, void *elem, int index);
 
+/*
+ * Vector_resize
+ *
+ * Sets the length of the Vector. New slots are NULL; elements past
+ * a shorter length are dropped, not freed
+ *
+ * CREs         vec == NULL
+ *              0 > length >= INT_MAX
+ * UREs         dropping the only reference to an element
+ *
+ * @param       Vector_T        Vector to be resized
+ * @param       int             New length
+ * @return      n/a
+ */
+void Vector_resize(Vector_T vec, int length);
+
 /*
  * Vector_append
  *
@@ -229,4 +333,266 @@ void Vector_removehi(Vector_T vec);
  */
 void Vector_removelo(Vector_T vec);
 
+/*
+ * Vector_swap_remove
+ *
+ * Removes the element at the given index in O(1) by moving the
+ * last element into its slot. The order of the remaining elements
+ * is not kept. It is the client's responsibility to free the
+ * element in the given index
+ *
+ * CREs         vec == NULL
+ *              index out of bounds
+ * UREs         n/a
+ *
+ * @param       Vector_T        Vector containing queried
+ *                              element
+ * @param       int             Index of element in Vector
+ * @return      n/a
+ */
+void Vector_swap_remove(Vector_T vec, int index);
+
+/*
+ * Vector_mark_removed
+ *
+ * Marks the element at the given index for removal by the next
+ * Vector_compact, in O(1). Marked elements stay in place, and are
+ * still returned by Vector_get and the iterators, until then. It is
+ * the client's responsibility to free marked elements
+ *
+ * CREs         vec == NULL
+ *              index out of bounds
+ * UREs         adding, removing or reordering elements while any
+ *              are marked, other than through Vector_compact
+ *
+ * @param       Vector_T        Vector containing queried
+ *                              element
+ * @param       int             Index of element in Vector
+ * @return      n/a
+ */
+void Vector_mark_removed(Vector_T vec, int index);
+
+/*
+ * Vector_is_removed
+ *
+ * Returns true if the element at the given index is marked for
+ * removal
+ *
+ * CREs         vec == NULL
+ *              index out of bounds
+ * UREs         n/a
+ *
+ * @param       Vector_T        Vector containing queried
+ *                              element
+ * @param       int             Index of element in Vector
+ * @return      bool            true if marked
+ */
+bool Vector_is_removed(Vector_T vec, int index);
+
+/*
+ * Vector_compact
+ *
+ * Removes every marked element, keeping the order of the rest, in
+ * one pass over the Vector. Returns the number removed
+ *
+ * CREs         vec == NULL
+ * UREs         n/a
+ *
+ * @param       Vector_T        Vector to compact
+ * @return      int             Number of elements removed
+ */
+int Vector_compact(Vector_T vec);
+
+//////////////////////////////////
+//      Iteration Functions     //
+//////////////////////////////////
+/*
+ * Vector_iter
+ *
+ * Returns an iterator over the elements of the Vector, first to
+ * last. Advancing it is a pointer increment
+ *
+ * CREs         vec == NULL
+ * UREs         changing the Vector while iterating
+ *
+ * @param       Vector_T        Vector to iterate over
+ * @return      Iter_T          Iterator over the elements
+ */
+Iter_T Vector_iter(Vector_T vec);
+
+/*
+ * Vector_collect
+ *
+ * Drains iter into a new Vector, in order. This is the usual end of
+ * an adapter pipeline: only the final Vector is ever allocated
+ *
+ * CREs         iter == NULL
+ * UREs         n/a
+ *
+ * @param       Iter_T *        Iterator to drain
+ * @return      Vector_T        New Vector of the elements
+ */
+Vector_T Vector_collect(Iter_T *iter);
+
+//////////////////////////////////
+//      Stream Functions        //
+//////////////////////////////////
+/*
+ * Vector_write
+ *
+ * Writes every element of the Vector to fp in the Serial stream
+ * format, encoding each with the given codec. Returns false on a
+ * write or encode error
+ *
+ * CREs         vec == NULL
+ *              fp == NULL
+ *              codec == NULL or codec->encode == NULL
+ * UREs         n/a
+ *
+ * @param       Vector_T                Vector to write
+ * @param       FILE *                  Stream to write to
+ * @param       const Serial_Codec_T *  Codec for the elements
+ * @return      bool                    true on success
+ */
+bool Vector_write(Vector_T vec, FILE *fp, const Serial_Codec_T *codec);
+
+/*
+ * Vector_read
+ *
+ * Reads a Serial stream written by Vector_write or DLinkedList_write
+ * from fp into a new Vector. On a read or format error, elements
+ * decoded so far are released with codec->free, if set, and NULL
+ * is returned
+ *
+ * CREs         fp == NULL
+ *              codec == NULL or codec->decode == NULL
+ * UREs         n/a
+ *
+ * @param       FILE *                  Stream to read from
+ * @param       const Serial_Codec_T *  Codec for the elements
+ * @return      Vector_T                New Vector, or NULL
+ */
+Vector_T Vector_read(FILE *fp, const Serial_Codec_T *codec);
+
+//////////////////////////////////
+//      Gather Functions        //
+//////////////////////////////////
+/*
+ * Vector_iovec
+ *
+ * Describes the buffers held by the Vector as an iovec array, for
+ * writev or vmsplice without first copying them together. Each
+ * element is taken to point at a buffer of length(elem, cl) bytes;
+ * buffers that sit back to back in memory share one iovec, and
+ * empty ones are skipped. Starts at element *index and fills at
+ * most iovcnt entries, then advances *index past the elements
+ * described, so repeated calls walk the whole Vector
+ *
+ * CREs         vec == NULL
+ *              index == NULL or 0 > *index > length
+ *              iov == NULL or iovcnt <= 0
+ *              length == NULL
+ * UREs         changing the Vector or its buffers before the
+ *              iovecs are used
+ *
+ * @param       Vector_T        Vector of buffers
+ * @param       int *           First element to describe; set to
+ *                              the first element not described
+ * @param       struct iovec *  Array to fill
+ * @param       int             Capacity of iov
+ * @param       function        Byte length of an element's buffer
+ * @param       void *          Closure passed to length
+ * @return      int             Number of iovecs filled
+ */
+int Vector_iovec(Vector_T vec, int *index, struct iovec *iov, int iovcnt,
+                 size_t length(void *elem, void *cl), void *cl);
+
+/*
+ * Vector_writev
+ *
+ * Writes the buffers held by the Vector to fd in order, gathering
+ * them with Vector_iovec so they are never copied in user space.
+ * Returns the number of bytes written, or -1 on error
+ *
+ * CREs         vec == NULL
+ *              length == NULL
+ * UREs         n/a
+ *
+ * @param       Vector_T        Vector of buffers
+ * @param       int             File descriptor to write to
+ * @param       function        Byte length of an element's buffer
+ * @param       void *          Closure passed to length
+ * @return      ssize_t         Bytes written, or -1
+ */
+ssize_t Vector_writev(Vector_T vec, int fd,
+                      size_t length(void *elem, void *cl), void *cl);
+
+//////////////////////////////////
+//      Buffer Cache            //
+//////////////////////////////////
+/*
+ * Each thread can keep the backing arrays of the heap Vectors it
+ * frees or grows, bucketed by capacity, and hand them to the next
+ * Vectors it creates or grows instead of going to the allocator.
+ * While the cache is on, capacities are rounded up to 2^k - 1 slots
+ * so arrays fall into a few reusable classes. It is off by default,
+ * and Arena-backed Vectors never use it
+ */
+
+/*
+ * Vector_cache_enable
+ *
+ * Turns the calling thread's buffer cache on, keeping at most limit
+ * arrays per capacity class, or off when limit is 0. Arrays beyond
+ * the new limit are released
+ *
+ * CREs         limit < 0
+ * UREs         n/a
+ *
+ * @param       int             Arrays to keep per class, or 0
+ * @return      n/a
+ */
+void Vector_cache_enable(int limit);
+
+/*
+ * Vector_cache_trim
+ *
+ * Releases the arrays in the calling thread's cache beyond keep per
+ * class, leaving the cache on
+ *
+ * CREs         keep < 0
+ * UREs         n/a
+ *
+ * @param       int             Arrays to keep per class
+ * @return      n/a
+ */
+void Vector_cache_trim(int keep);
+
+/*
+ * Vector_cache_bytes
+ *
+ * Returns the number of bytes of backing arrays held in the calling
+ * thread's cache
+ *
+ * CREs         n/a
+ * UREs         n/a
+ *
+ * @return      size_t          Bytes held by the cache
+ */
+size_t Vector_cache_bytes(void);
+
+/*
+ * Vector_cache_free
+ *
+ * Releases every array in the calling thread's cache and turns it
+ * off. Threads that enabled the cache should call this before
+ * exiting
+ *
+ * CREs         n/a
+ * UREs         n/a
+ *
+ * @return      n/a
+ */
+void Vector_cache_free(void);
+
 #endif
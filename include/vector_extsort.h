@@ -0,0 +1,131 @@
+/*
+ *      filename:       vector_extsort.h
+ *      author:         @keiferchiang
+ *      date:           18 Oct 2026
+ *      version:        0.0.1
+ *
+ *      description:    Interface for the external Vector sort, which
+ *                      sorts streams larger than memory. The input is
+ *                      cut into runs that are sorted in memory and
+ *                      spilled to temporary files in the Serial
+ *                      format; the runs are then merged back as a
+ *                      stream
+ *
+ *      usage:          Vector_Extsort_T sort;
+ *                      Iter_T it;
+ *
+ *                      sort = Vector_external_sort(&input, cmp, NULL,
+ *                                                  &codec, 1 << 20);
+ *                      it = Vector_extsort_iter(sort);
+ *                      CDS_FOREACH(elem, it)
+ *                              ...
+ *                      Vector_extsort_free(&sort);
+ */
+
+/*-------------------------------------
+ * C Preprocessor Directives
+ -------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <limits.h>
+#include <assert.h>
+
+#ifndef VECTOR_EXTSORT_H_
+#define VECTOR_EXTSORT_H_
+
+#include "iter.h"
+#include "serial.h"
+#include "vector.h"
+#include "vector_sort.h"
+
+/*-------------------------------------
+ * Representation
+ -------------------------------------*/
+typedef struct vector_extsort_t *Vector_Extsort_T;
+
+/*-------------------------------------
+ * Function Prototypes
+ -------------------------------------*/
+/*
+ * Vector_external_sort
+ *
+ * Drains input run_length elements at a time, sorting each batch
+ * with Vector_sort and spilling it through codec to a temporary
+ * file, then sets up a merge of the spilled runs. Every element is
+ * released with codec->free once spilled; the sorted stream yields
+ * freshly decoded copies. Input that fits in a single batch is
+ * never spilled and its elements are yielded as they are.
+ *
+ * run_length bounds the elements held in memory at once. Returns
+ * NULL, having released every element read, if a temporary file
+ * cannot be created or written
+ *
+ * CREs         input == NULL
+ *              cmp == NULL
+ *              codec == NULL, codec->encode == NULL or
+ *              codec->decode == NULL
+ *              run_length <= 0
+ * UREs         cmp is not a consistent ordering
+ *              elements own memory and codec->free == NULL
+ *
+ * @param       Iter_T *                Elements to sort
+ * @param       function                Compares two elements
+ * @param       void *                  Closure passed to cmp
+ * @param       const Serial_Codec_T *  Codec for spilling elements
+ * @param       int                     Elements per in-memory run
+ * @return      Vector_Extsort_T        The sort, or NULL
+ */
+Vector_Extsort_T Vector_external_sort(Iter_T *input,
+                                      int cmp(void *a, void *b, void *cl),
+                                      void *cl, const Serial_Codec_T *codec,
+                                      int run_length);
+
+/*
+ * Vector_extsort_iter
+ *
+ * Returns an iterator over the sorted elements, which are the
+ * client's once yielded. Runs are merged lazily as the iterator
+ * advances, so memory use stays bounded. Vector_collect turns the
+ * result into a Vector when it fits in memory
+ *
+ * CREs         sort == NULL
+ * UREs         using the iterator after Vector_extsort_free
+ *              calling this more than once per sort
+ *
+ * @param       Vector_Extsort_T        The sort
+ * @return      Iter_T                  Iterator in ascending order
+ */
+Iter_T Vector_extsort_iter(Vector_Extsort_T sort);
+
+/*
+ * Vector_extsort_failed
+ *
+ * Returns true if the merge stopped early on a read or format
+ * error in a spilled run
+ *
+ * CREs         sort == NULL
+ * UREs         n/a
+ *
+ * @param       Vector_Extsort_T        The sort
+ * @return      bool                    true on error
+ */
+bool Vector_extsort_failed(Vector_Extsort_T sort);
+
+/*
+ * Vector_extsort_free
+ *
+ * Closes and deletes the temporary files and frees the sort.
+ * Elements not yet yielded are released with codec->free
+ *
+ * CREs         sort == NULL
+ *              *sort == NULL
+ * UREs         n/a
+ *
+ * @param       Vector_Extsort_T *      Pointer to the sort
+ * @return      n/a
+ */
+void Vector_extsort_free(Vector_Extsort_T *sort);
+
+#endif
@@ -0,0 +1,137 @@
+/*
+ *      filename:       vector_par.h
+ *      author:         @keiferchiang
+ *      date:           18 Oct 2026
+ *      version:        0.0.1
+ *
+ *      description:    Interface for the parallel Vector functions:
+ *                      prefix sums, partition and filtering. Each
+ *                      splits the Vector into one block per thread
+ *                      and runs the two-pass block algorithm: every
+ *                      thread summarizes its block, the summaries are
+ *                      scanned, and every thread then finishes its
+ *                      block from its scanned offset
+ *
+ *                      nthreads <= 0 uses one thread per online CPU.
+ *                      Vectors too small to be worth splitting are
+ *                      processed on the calling thread
+ */
+
+/*-------------------------------------
+ * C Preprocessor Directives
+ -------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <limits.h>
+#include <assert.h>
+#include <stdint.h>
+
+#ifndef VECTOR_PAR_H_
+#define VECTOR_PAR_H_
+
+#include "vector.h"
+
+/*-------------------------------------
+ * Function Prototypes
+ -------------------------------------*/
+/*
+ * Vector_scan
+ *
+ * Replaces each slot of a value-typed Vector with the prefix sum
+ * ending at it: inclusive sums count the slot itself, exclusive
+ * sums count only the slots before it. Sums wrap on overflow.
+ * Returns the sum of the whole Vector
+ *
+ * CREs         vec == NULL
+ * UREs         vec is not value-typed
+ *
+ * @param       Vector_T        Value-typed Vector to scan in place
+ * @param       bool            true for an inclusive scan
+ * @param       int             Number of threads
+ * @return      intptr_t        Sum of every slot
+ */
+intptr_t Vector_scan(Vector_T vec, bool inclusive, int nthreads);
+
+/*
+ * Vector_partition
+ *
+ * Stably reorders the Vector so the elements for which pred
+ * returns true come first, and returns how many there are. pred is
+ * called once per element, from several threads at once
+ *
+ * CREs         vec == NULL
+ *              pred == NULL
+ * UREs         pred is not thread safe
+ *
+ * @param       Vector_T        Vector to partition in place
+ * @param       function        Predicate on an element
+ * @param       void *          Closure passed to pred
+ * @param       int             Number of threads
+ * @return      int             Number of elements satisfying pred
+ */
+int Vector_partition(Vector_T vec, bool pred(void *elem, void *cl),
+                     void *cl, int nthreads);
+
+/*
+ * Vector_filter
+ *
+ * Returns a new Vector of the elements for which pred returns true,
+ * in their original order (stream compaction). vec is unchanged.
+ * pred is called once per element, from several threads at once
+ *
+ * CREs         vec == NULL
+ *              pred == NULL
+ * UREs         pred is not thread safe
+ *
+ * @param       Vector_T        Vector to filter
+ * @param       function        Predicate on an element
+ * @param       void *          Closure passed to pred
+ * @param       int             Number of threads
+ * @return      Vector_T        New Vector of the kept elements
+ */
+Vector_T Vector_filter(Vector_T vec, bool pred(void *elem, void *cl),
+                       void *cl, int nthreads);
+
+//////////////////////////////////
+//      Thread Functions        //
+//////////////////////////////////
+/*
+ * Vector_par_blocks
+ *
+ * Returns the number of blocks, one per thread, that length slots
+ * should be split into when nthreads are requested. Never more than
+ * nthreads, and 1 when length is too small to be worth splitting
+ *
+ * CREs         length < 0
+ * UREs         n/a
+ *
+ * @param       int             Number of slots
+ * @param       int             Requested threads, <= 0 for all CPUs
+ * @return      int             Number of blocks
+ */
+int Vector_par_blocks(int length, int nthreads);
+
+/*
+ * Vector_par_run
+ *
+ * Calls worker on each of the ntasks task structs of size bytes
+ * laid out from tasks, each on its own thread, and returns once
+ * all have finished. The calling thread runs the first task
+ *
+ * CREs         worker == NULL
+ *              tasks == NULL
+ *              ntasks <= 0
+ * UREs         n/a
+ *
+ * @param       function        Runs one task
+ * @param       void *          Array of task structs
+ * @param       size_t          Size of a task struct
+ * @param       int             Number of tasks
+ * @return      n/a
+ */
+void Vector_par_run(void worker(void *task), void *tasks, size_t size,
+                    int ntasks);
+
+#endif
@@ -0,0 +1,193 @@
+/*
+ *      filename:       vector_set.h
+ *      author:         @keiferchiang
+ *      date:           18 Oct 2026
+ *      version:        0.0.1
+ *
+ *      description:    Interface for the Vector set functions, which
+ *                      remove duplicate elements from a Vector and
+ *                      combine sorted Vectors as sets
+ *
+ *                      Functions taking an eq or hash callback treat
+ *                      NULL as comparing or hashing the slots
+ *                      themselves, which suits value-typed Vectors
+ *                      and Vectors of interned pointers
+ */
+
+/*-------------------------------------
+ * C Preprocessor Directives
+ -------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <limits.h>
+#include <assert.h>
+#include <stdint.h>
+
+#ifndef VECTOR_SET_H_
+#define VECTOR_SET_H_
+
+#include "vector.h"
+#include "vector_par.h"
+#include "vector_sort.h"
+
+/*-------------------------------------
+ * Function Prototypes
+ -------------------------------------*/
+//////////////////////////////////
+//      Deduplication           //
+//////////////////////////////////
+/*
+ * Vector_unique
+ *
+ * Removes every element equal to the one before it, keeping the
+ * first of each run, in one pass. On a sorted Vector this leaves
+ * each distinct element once. Returns the number removed
+ *
+ * CREs         vec == NULL
+ * UREs         n/a
+ *
+ * @param       Vector_T        Vector to compact in place
+ * @param       function        Element equality, or NULL
+ * @param       void *          Closure passed to eq
+ * @return      int             Number of elements removed
+ */
+int Vector_unique(Vector_T vec, bool eq(void *a, void *b, void *cl),
+                  void *cl);
+
+/*
+ * Vector_dedup
+ *
+ * Removes every element equal to an earlier one, keeping the first
+ * occurrence of each and their order, using a temporary
+ * open-addressing hash set. O(n) expected, with hash called once
+ * per element and eq only on hash collisions. Returns the number
+ * removed
+ *
+ * CREs         vec == NULL
+ * UREs         elements that are eq hash differently
+ *
+ * @param       Vector_T        Vector to compact in place
+ * @param       function        Element hash, or NULL
+ * @param       function        Element equality, or NULL
+ * @param       void *          Closure passed to hash and eq
+ * @return      int             Number of elements removed
+ */
+int Vector_dedup(Vector_T vec, uint64_t hash(void *elem, void *cl),
+                 bool eq(void *a, void *b, void *cl), void *cl);
+
+/*
+ * Vector_dedup_par
+ *
+ * Removes elements with duplicate keys by sorting and then removing
+ * adjacent duplicates, both on nthreads threads. Elements are
+ * duplicates exactly when their keys are equal, so key must be an
+ * identity such as a record ID. The Vector is left sorted by key,
+ * keeping the first occurrence of each. Returns the number removed.
+ * See vector_par.h for the meaning of nthreads and vector_sort.h
+ * for key; key is called from several threads at once
+ *
+ * CREs         vec == NULL
+ * UREs         key == NULL and vec is not value-typed
+ *              key is not thread safe
+ *
+ * @param       Vector_T        Vector to compact in place
+ * @param       function        Extracts an element's key, or NULL
+ * @param       void *          Closure passed to key
+ * @param       int             Number of threads
+ * @return      int             Number of elements removed
+ */
+int Vector_dedup_par(Vector_T vec, uint64_t key(void *elem, void *cl),
+                     void *cl, int nthreads);
+
+//////////////////////////////////
+//      Sorted Set Operations   //
+//////////////////////////////////
+/*
+ * The operations below take two Vectors sorted in ascending order
+ * under cmp and free of duplicates, and return a new Vector, also
+ * sorted and free of duplicates. A NULL cmp compares signed slot
+ * values. Where an element is in both inputs, a's copy is kept.
+ *
+ * When one input is much longer than the other, the longer one is
+ * stepped through by galloping (exponential) search, so the cost
+ * approaches O(m log(n / m)) for the m elements of the shorter
+ * rather than O(n + m). Intersections of value-typed Vectors of
+ * similar lengths run branch-free, and on AVX2 builds compare a
+ * block of slots at a time
+ */
+
+/*
+ * Vector_union
+ *
+ * Returns the elements in a, b or both
+ *
+ * CREs         a == NULL
+ *              b == NULL
+ * UREs         a or b not sorted under cmp, or with duplicates
+ *
+ * @param       Vector_T        First sorted set
+ * @param       Vector_T        Second sorted set
+ * @param       function        Compares two elements, or NULL
+ * @param       void *          Closure passed to cmp
+ * @return      Vector_T        New sorted set
+ */
+Vector_T Vector_union(Vector_T a, Vector_T b,
+                      int cmp(void *x, void *y, void *cl), void *cl);
+
+/*
+ * Vector_intersect
+ *
+ * Returns the elements in both a and b
+ *
+ * CREs         a == NULL
+ *              b == NULL
+ * UREs         a or b not sorted under cmp, or with duplicates
+ *
+ * @param       Vector_T        First sorted set
+ * @param       Vector_T        Second sorted set
+ * @param       function        Compares two elements, or NULL
+ * @param       void *          Closure passed to cmp
+ * @return      Vector_T        New sorted set
+ */
+Vector_T Vector_intersect(Vector_T a, Vector_T b,
+                          int cmp(void *x, void *y, void *cl), void *cl);
+
+/*
+ * Vector_difference
+ *
+ * Returns the elements in a but not in b
+ *
+ * CREs         a == NULL
+ *              b == NULL
+ * UREs         a or b not sorted under cmp, or with duplicates
+ *
+ * @param       Vector_T        First sorted set
+ * @param       Vector_T        Second sorted set
+ * @param       function        Compares two elements, or NULL
+ * @param       void *          Closure passed to cmp
+ * @return      Vector_T        New sorted set
+ */
+Vector_T Vector_difference(Vector_T a, Vector_T b,
+                           int cmp(void *x, void *y, void *cl), void *cl);
+
+/*
+ * Vector_symdiff
+ *
+ * Returns the elements in exactly one of a and b
+ *
+ * CREs         a == NULL
+ *              b == NULL
+ * UREs         a or b not sorted under cmp, or with duplicates
+ *
+ * @param       Vector_T        First sorted set
+ * @param       Vector_T        Second sorted set
+ * @param       function        Compares two elements, or NULL
+ * @param       void *          Closure passed to cmp
+ * @return      Vector_T        New sorted set
+ */
+Vector_T Vector_symdiff(Vector_T a, Vector_T b,
+                        int cmp(void *x, void *y, void *cl), void *cl);
+
+#endif
@@ -0,0 +1,172 @@
+/*
+ *      filename:       vector_sort.h
+ *      author:         @keiferchiang
+ *      date:           18 Oct 2026
+ *      version:        0.0.1
+ *
+ *      description:    Interface for the Vector sorting functions
+ */
+
+/*-------------------------------------
+ * C Preprocessor Directives
+ -------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <limits.h>
+#include <assert.h>
+#include <stdint.h>
+
+#ifndef VECTOR_SORT_H_
+#define VECTOR_SORT_H_
+
+#include "vector.h"
+#include "vector_par.h"
+
+/*-------------------------------------
+ * Function Prototypes
+ -------------------------------------*/
+//////////////////////////////////
+//      Comparison Sort         //
+//////////////////////////////////
+/*
+ * Comparison functions return a negative, zero or positive value
+ * when a is less than, equal to or greater than b
+ */
+
+/*
+ * Vector_sort
+ *
+ * Sorts the Vector in ascending order under cmp. Introsort:
+ * quicksort with median-of-three pivots that falls back to heapsort
+ * on bad inputs, so it is O(n log n) in the worst case. Not stable
+ *
+ * CREs         vec == NULL
+ *              cmp == NULL
+ * UREs         cmp is not a consistent ordering
+ *
+ * @param       Vector_T        Vector to sort in place
+ * @param       function        Compares two elements
+ * @param       void *          Closure passed to cmp
+ * @return      n/a
+ */
+void Vector_sort(Vector_T vec, int cmp(void *a, void *b, void *cl),
+                 void *cl);
+
+/*
+ * Vector_nth_element
+ *
+ * Reorders the Vector so the element at index n is the one a full
+ * sort would put there, with no element before it greater and no
+ * element after it smaller. Introselect: quickselect that falls
+ * back to heapsort on bad inputs. O(n) expected
+ *
+ * CREs         vec == NULL
+ *              0 > n >= length
+ *              cmp == NULL
+ * UREs         cmp is not a consistent ordering
+ *
+ * @param       Vector_T        Vector to reorder in place
+ * @param       int             Index to select
+ * @param       function        Compares two elements
+ * @param       void *          Closure passed to cmp
+ * @return      n/a
+ */
+void Vector_nth_element(Vector_T vec, int n,
+                        int cmp(void *a, void *b, void *cl), void *cl);
+
+/*
+ * Vector_partial_sort
+ *
+ * Reorders the Vector so its first k elements are the k smallest,
+ * in ascending order. The order of the rest is unspecified. Costs
+ * O(n + k log k) rather than the O(n log n) of a full sort
+ *
+ * CREs         vec == NULL
+ *              k < 0
+ *              cmp == NULL
+ * UREs         cmp is not a consistent ordering
+ *
+ * @param       Vector_T        Vector to reorder in place
+ * @param       int             Number of leading elements to sort
+ * @param       function        Compares two elements
+ * @param       void *          Closure passed to cmp
+ * @return      n/a
+ */
+void Vector_partial_sort(Vector_T vec, int k,
+                         int cmp(void *a, void *b, void *cl), void *cl);
+
+//////////////////////////////////
+//      Radix Sort              //
+//////////////////////////////////
+/*
+ * Vector_radix_sort
+ *
+ * Stably sorts the Vector in ascending order of an unsigned 64-bit
+ * key, least significant byte first. key is called once per
+ * element; a NULL key sorts a value-typed Vector by its signed
+ * slot values. Digits on which every key agrees are skipped, so
+ * 32-bit keys cost half the passes of 64-bit ones
+ *
+ * CREs         vec == NULL
+ * UREs         key == NULL and vec is not value-typed
+ *
+ * @param       Vector_T        Vector to sort in place
+ * @param       function        Extracts an element's key, or NULL
+ * @param       void *          Closure passed to key
+ * @return      n/a
+ */
+void Vector_radix_sort(Vector_T vec, uint64_t key(void *elem, void *cl),
+                       void *cl);
+
+/*
+ * Vector_radix_sort_par
+ *
+ * Same as Vector_radix_sort, with keys extracted and every pass
+ * histogrammed and scattered by nthreads threads, each keeping its
+ * own histograms. See vector_par.h for the meaning of nthreads.
+ * key is called from several threads at once
+ *
+ * CREs         vec == NULL
+ * UREs         key == NULL and vec is not value-typed
+ *              key is not thread safe
+ *
+ * @param       Vector_T        Vector to sort in place
+ * @param       function        Extracts an element's key, or NULL
+ * @param       void *          Closure passed to key
+ * @param       int             Number of threads
+ * @return      n/a
+ */
+void Vector_radix_sort_par(Vector_T vec, uint64_t key(void *elem, void *cl),
+                           void *cl, int nthreads);
+
+/*
+ * Vector_float_key
+ *
+ * Maps a double to an unsigned key with the same order, for key
+ * functions sorting on floating-point fields. NaNs sort after
+ * +infinity when positive and before -infinity when negative
+ *
+ * CREs         n/a
+ * UREs         n/a
+ *
+ * @param       double          Value to map
+ * @return      uint64_t        Order-preserving key
+ */
+uint64_t Vector_float_key(double value);
+
+/*
+ * Vector_int_key
+ *
+ * Maps a signed integer to an unsigned key with the same order
+ *
+ * CREs         n/a
+ * UREs         n/a
+ *
+ * @param       int64_t         Value to map
+ * @return      uint64_t        Order-preserving key
+ */
+uint64_t Vector_int_key(int64_t value);
+
+#endif
@@ -0,0 +1,128 @@
+/*
+ *      filename:       xmastree.h
+ *      author:         @keiferchiang
+ *      date:           18 Oct 2026
+ *      version:        0.0.1
+ *
+ *      description:    Interface for the XmasTree module, a concurrent
+ *                      priority queue that never makes everyone wait
+ *                      while one heap is rebuilt. It is a MultiQueue:
+ *                      several lock-protected binary heaps, with each
+ *                      push going to a random heap and each pop taking
+ *                      the lesser of the minima of two random heaps.
+ *                      The ordering is relaxed: a pop returns an
+ *                      element close to, but not always exactly, the
+ *                      least one held
+ *
+ *      usage:          XmasTree_T open = XmasTree_new(0, by_cost, NULL);
+ *                      (from any thread)
+ *                      XmasTree_push(open, node);
+ *                      while (XmasTree_pop(open, &node))
+ *                              expand(node);
+ */
+
+/*-------------------------------------
+ * C Preprocessor Directives
+ -------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <limits.h>
+#include <assert.h>
+
+#ifndef XMASTREE_H_
+#define XMASTREE_H_
+
+#include "vector.h"
+
+/*-------------------------------------
+ * Representation
+ -------------------------------------*/
+typedef struct xmastree_t *XmasTree_T;
+
+/*-------------------------------------
+ * Function Prototypes
+ -------------------------------------*/
+/*
+ * XmasTree_new
+ *
+ * Creates and returns an empty XmasTree for use by up to nthreads
+ * threads at once, ordered by cmp, which returns a negative, zero
+ * or positive value when a is less than, equal to or greater than
+ * b. nthreads <= 0 means one per online CPU. More heaps per thread
+ * mean less contention but pops further from the true minimum
+ *
+ * CREs         cmp == NULL
+ * UREs         cmp is not a consistent ordering
+ *
+ * @param       int             Number of threads, or <= 0
+ * @param       function        Compares two elements
+ * @param       void *          Closure passed to cmp
+ * @return      XmasTree_T      An empty XmasTree
+ */
+XmasTree_T XmasTree_new(int nthreads, int cmp(void *a, void *b, void *cl),
+                        void *cl);
+
+/*
+ * XmasTree_free
+ *
+ * Recycles heap allocated memory for the XmasTree. It is the
+ * client's responsibility to free the elements first
+ *
+ * CREs         tree == NULL
+ *              *tree == NULL
+ * UREs         other threads still using the XmasTree
+ *
+ * @param       XmasTree_T *    Pointer to the XmasTree
+ * @return      n/a
+ */
+void XmasTree_free(XmasTree_T *tree);
+
+/*
+ * XmasTree_push
+ *
+ * Adds elem in O(log n). Thread safe
+ *
+ * CREs         tree == NULL
+ * UREs         n/a
+ *
+ * @param       XmasTree_T      XmasTree to add to
+ * @param       void *          Element to add
+ * @return      n/a
+ */
+void XmasTree_push(XmasTree_T tree, void *elem);
+
+/*
+ * XmasTree_pop
+ *
+ * Removes an element near the minimum and stores it in *elem,
+ * returning true, or returns false if every heap was found empty.
+ * With other threads pushing, false only means the XmasTree was
+ * empty at some moment during the call. Thread safe
+ *
+ * CREs         tree == NULL
+ *              elem == NULL
+ * UREs         n/a
+ *
+ * @param       XmasTree_T      XmasTree to remove from
+ * @param       void **         Location for the element
+ * @return      bool            true if an element was removed
+ */
+bool XmasTree_pop(XmasTree_T tree, void **elem);
+
+/*
+ * XmasTree_length
+ *
+ * Returns the number of elements held. With other threads pushing
+ * or popping, the count is only approximate. Thread safe
+ *
+ * CREs         tree == NULL
+ * UREs         n/a
+ *
+ * @param       XmasTree_T      XmasTree to query
+ * @return      int             Number of elements
+ */
+int XmasTree_length(XmasTree_T tree);
+
+#endif
@@ -0,0 +1,361 @@
+/*
+ *      filename:       arena.c
+ *      author:         @keiferchiang
+ *      date:           18 Oct 2026
+ *      version:        0.0.1
+ *
+ *      description:    Implementation of the Arena module
+ *
+ *      note:           An Arena is a stack of chunks. Allocation bumps
+ *                      avail through the chunk on top of the stack and
+ *                      pushes a new chunk once it runs out. Rewinding
+ *                      pops chunks onto a spare list instead of
+ *                      freeing them, so an Arena that is repeatedly
+ *                      filled and reset stops touching the system
+ *                      allocator after the first round.
+ *
+ *      design:         chunk -> [ header | used | avail ... limit ]
+ *                                 |
+ *                                 v prev
+ *                               [ header | used .......... limit ]
+ */
+
+#ifndef _DEFAULT_SOURCE
+#define _DEFAULT_SOURCE
+#endif
+
+#include <stdint.h>
+
+#include "arena.h"
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
+#if defined(MAP_ANONYMOUS) && defined(MADV_HUGEPAGE)
+#define ARENA_HUGEPAGES
+#endif
+
+/*-------------------------------------
+ * Constants
+ -------------------------------------*/
+#define DEFAULT_CHUNK   (64 * 1024)
+#define HUGE_PAGE       (2 * 1024 * 1024)
+
+/*-------------------------------------
+ * Representation
+ -------------------------------------*/
+/*
+ * Strictest alignment of the basic types, i.e. what malloc
+ * guarantees
+ */
+union align {
+        long l;
+        double d;
+        long double ld;
+        void *p;
+        void (*fp)(void);
+};
+
+typedef struct chunk_t {
+        struct chunk_t *prev;
+        char *limit;
+        size_t size;
+        bool mapped;
+} *Chunk_T;
+
+/*
+ * Pads the chunk header so that chunk memory starts maximally
+ * aligned
+ */
+union header {
+        struct chunk_t c;
+        union align a;
+};
+
+/* First usable byte of a chunk */
+#define CHUNK_MEM(chunk) ((char *) ((union header *) (chunk) + 1))
+
+struct arena_t {
+        Chunk_T chunk;
+        char *avail;
+        char *limit;
+        Chunk_T spare;
+        size_t chunk_size;
+        bool huge;
+};
+
+/*-------------------------------------
+ * Globals
+ -------------------------------------*/
+static __thread Arena_T thread_arena = NULL;
+
+/*-------------------------------------
+ * Helper/Private Prototypes
+ -------------------------------------*/
+/*
+ * Pushes a chunk with at least nbytes of free memory, reusing a
+ * spare chunk when one is large enough
+ */
+static void push_chunk(Arena_T arena, size_t nbytes);
+
+/*
+ * Allocates a chunk of size bytes, header included, from mmap when
+ * huge pages are requested and available, or from malloc otherwise
+ */
+static Chunk_T chunk_new(size_t size, bool huge);
+
+/*
+ * Returns the chunk to wherever it was allocated from
+ */
+static void chunk_free(Chunk_T chunk);
+
+/*
+ * Rounds ptr up to the next multiple of align
+ */
+static inline char *align_up(char *ptr, size_t align);
+
+/*-------------------------------------
+ * Function Definitions
+ -------------------------------------*/
+Arena_T Arena_new(size_t hint, bool huge)
+{
+        Arena_T arena;
+
+        arena = malloc(sizeof(struct arena_t));
+        assert(arena != NULL);
+
+        if (hint == 0)
+                hint = DEFAULT_CHUNK;
+
+        arena->chunk = NULL;
+        arena->avail = NULL;
+        arena->limit = NULL;
+        arena->spare = NULL;
+        arena->chunk_size = hint;
+        arena->huge = huge;
+
+        return arena;
+}
+
+void Arena_free(Arena_T *arena)
+{
+        Chunk_T chunk;
+
+        assert(arena != NULL);
+        assert(*arena != NULL);
+
+        Arena_reset(*arena);
+
+        while ((chunk = (*arena)->spare) != NULL) {
+                (*arena)->spare = chunk->prev;
+                chunk_free(chunk);
+        }
+
+        free(*arena);
+        *arena = NULL;
+}
+
+void *Arena_alloc(Arena_T arena, size_t nbytes, size_t align)
+{
+        char *ptr;
+
+        assert(arena != NULL);
+        assert((align & (align - 1)) == 0);
+
+        if (align == 0)
+                align = sizeof(union align);
+
+        if (arena->chunk != NULL) {
+                ptr = align_up(arena->avail, align);
+                if (ptr <= arena->limit &&
+                    nbytes <= (size_t) (arena->limit - ptr)) {
+                        arena->avail = ptr + nbytes;
+                        return ptr;
+                }
+        }
+
+        assert(nbytes <= SIZE_MAX - align - sizeof(union header));
+        push_chunk(arena, nbytes + align);
+
+        ptr = align_up(arena->avail, align);
+        arena->avail = ptr + nbytes;
+
+        return ptr;
+}
+
+void *Arena_calloc(Arena_T arena, size_t nbytes, size_t align)
+{
+        void *ptr;
+
+        ptr = Arena_alloc(arena, nbytes, align);
+        memset(ptr, 0, nbytes);
+
+        return ptr;
+}
+
+//////////////////////////////////
+//      Scope Functions         //
+//////////////////////////////////
+Arena_Mark_T Arena_mark(Arena_T arena)
+{
+        Arena_Mark_T mark;
+
+        assert(arena != NULL);
+
+        mark.chunk = arena->chunk;
+        mark.avail = arena->avail;
+
+        return mark;
+}
+
+void Arena_rewind(Arena_T arena, Arena_Mark_T mark)
+{
+        Chunk_T chunk;
+
+        assert(arena != NULL);
+
+        while (arena->chunk != mark.chunk) {
+                chunk = arena->chunk;
+                assert(chunk != NULL);
+
+                arena->chunk = chunk->prev;
+                chunk->prev = arena->spare;
+                arena->spare = chunk;
+        }
+
+        arena->avail = mark.avail;
+        arena->limit = (arena->chunk != NULL) ? arena->chunk->limit : NULL;
+}
+
+void Arena_reset(Arena_T arena)
+{
+        Arena_Mark_T empty = { NULL, NULL };
+
+        assert(arena != NULL);
+
+        Arena_rewind(arena, empty);
+}
+
+//////////////////////////////////
+//      Thread Functions        //
+//////////////////////////////////
+Arena_T Arena_thread(void)
+{
+        if (thread_arena == NULL)
+                thread_arena = Arena_new(0, false);
+
+        return thread_arena;
+}
+
+void Arena_thread_free(void)
+{
+        if (thread_arena != NULL)
+                Arena_free(&thread_arena);
+}
+
+/*-------------------------------------
+ * Helper/Private Definitions
+ -------------------------------------*/
+static void push_chunk(Arena_T arena, size_t nbytes)
+{
+        Chunk_T chunk;
+        Chunk_T *link;
+        size_t size;
+
+        assert(arena != NULL);
+
+        /* first fit among the spare chunks */
+        chunk = NULL;
+        for (link = &arena->spare; *link != NULL; link = &(*link)->prev) {
+                if ((size_t) ((*link)->limit - CHUNK_MEM(*link)) >= nbytes) {
+                        chunk = *link;
+                        *link = chunk->prev;
+                        break;
+                }
+        }
+
+        if (chunk == NULL) {
+                size = sizeof(union header) + nbytes;
+                if (size < arena->chunk_size)
+                        size = arena->chunk_size;
+                chunk = chunk_new(size, arena->huge);
+        }
+
+        chunk->prev = arena->chunk;
+        arena->chunk = chunk;
+        arena->avail = CHUNK_MEM(chunk);
+        arena->limit = chunk->limit;
+}
+
+static Chunk_T chunk_new(size_t size, bool huge)
+{
+        Chunk_T chunk = NULL;
+        bool mapped = false;
+
+#ifdef ARENA_HUGEPAGES
+        char *ptr, *start;
+        size_t slack;
+
+        if (huge && size <= SIZE_MAX - 2 * (size_t) HUGE_PAGE) {
+                size = (size + HUGE_PAGE - 1) & ~((size_t) HUGE_PAGE - 1);
+
+                /*
+                 * mmap only page-aligns, and huge pages only back
+                 * aligned 2 MB runs: map one extra huge page, keep the
+                 * aligned run inside it and unmap the slack either side
+                 */
+                ptr = mmap(NULL, size + HUGE_PAGE, PROT_READ | PROT_WRITE,
+                           MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+                if (ptr != MAP_FAILED) {
+                        start = align_up(ptr, HUGE_PAGE);
+                        slack = (size_t) (start - ptr);
+                        if (slack > 0)
+                                munmap(ptr, slack);
+                        if (slack < HUGE_PAGE)
+                                munmap(start + size, HUGE_PAGE - slack);
+
+                        madvise(start, size, MADV_HUGEPAGE);
+                        chunk = (Chunk_T) start;
+                        mapped = true;
+                }
+        }
+#else
+        (void) huge;
+#endif
+
+        if (chunk == NULL) {
+                chunk = malloc(size);
+                assert(chunk != NULL);
+        }
+
+        chunk->prev = NULL;
+        chunk->limit = (char *) chunk + size;
+        chunk->size = size;
+        chunk->mapped = mapped;
+
+        return chunk;
+}
+
+static void chunk_free(Chunk_T chunk)
+{
+        assert(chunk != NULL);
+
+#ifdef ARENA_HUGEPAGES
+        if (chunk->mapped) {
+                munmap(chunk, chunk->size);
+                return;
+        }
+#endif
+
+        free(chunk);
+}
+
+static inline char *align_up(char *ptr, size_t align)
+{
+        uintptr_t addr = (uintptr_t) ptr;
+
+        addr = (addr + align - 1) & ~((uintptr_t) align - 1);
+
+        return (char *) addr;
+}
@@ -0,0 +1,353 @@
+/*
+ *      filename:       deque.c
+ *      author:         @keiferchiang
+ *      date:           18 Oct 2026
+ *      version:        0.0.1
+ *
+ *      description:    Implementation of the Deque module
+ *
+ *      note:           The elements sit in blocks of BLOCK_SLOTS
+ *                      slots. The map is an array of block pointers
+ *                      with the blocks in use at [first, first +
+ *                      nblocks), and the front element at slot front
+ *                      of block first. Element i is therefore at
+ *                      position front + i counted across the blocks
+ *                      in use, found with a shift and a mask.
+ *
+ *                      The ends grow and shrink a block at a time.
+ *                      When the map runs out of entries at one end it
+ *                      is recentered, or doubled once more than half
+ *                      full. Only block pointers move; blocks do not.
+ *                      One emptied block is kept as a spare so an end
+ *                      oscillating across a block boundary does not
+ *                      call malloc and free each time.
+ *
+ *      design:         map     [ . | B0 | B1 | B2 | . | . ]
+ *                                    ^first
+ *                      B0      [ . . . x x x ]  <- front = 3
+ *                      B1      [ x x x x x x ]
+ *                      B2      [ x x . . . . ]
+ */
+
+#include "deque.h"
+
+/*-------------------------------------
+ * Constants
+ -------------------------------------*/
+#define BLOCK_SHIFT     7
+#define BLOCK_SLOTS     (1 << BLOCK_SHIFT)
+#define BLOCK_MASK      (BLOCK_SLOTS - 1)
+#define MIN_MAP         8
+
+/*-------------------------------------
+ * Representation
+ -------------------------------------*/
+typedef void **Block_T;
+
+struct deque_t {
+        Block_T *map;
+        int map_capacity;
+        int first;
+        int nblocks;
+        int front;
+        int size;
+        Block_T spare;
+};
+
+/*-------------------------------------
+ * Helper/Private Prototypes
+ -------------------------------------*/
+/*
+ * Returns the address of the slot at position pos, counted from the
+ * start of the first block in use
+ */
+static inline void **deque_at(Deque_T deque, int pos);
+
+/*
+ * Makes room in the map for one more block before the first or
+ * after the last block in use
+ */
+static void deque_reserve(Deque_T deque, bool at_front);
+
+/*
+ * Returns an empty block, reusing the spare if there is one
+ */
+static Block_T deque_block_new(Deque_T deque);
+
+/*
+ * Keeps block as the spare, or frees it if there already is one
+ */
+static void deque_block_release(Deque_T deque, Block_T block);
+
+/*
+ * Iterator callback walking the Deque a block at a time
+ */
+static bool deque_next(Iter_T *iter, void **elem);
+
+/*-------------------------------------
+ * Function Definitions
+ -------------------------------------*/
+Deque_T Deque_new(int hint)
+{
+        Deque_T deque;
+        int blocks;
+
+        assert(hint >= 0);
+        assert(hint < INT_MAX);
+
+        deque = malloc(sizeof(struct deque_t));
+        assert(deque != NULL);
+
+        blocks = hint / BLOCK_SLOTS + 1;
+        deque->map_capacity = 2 * blocks > MIN_MAP ? 2 * blocks : MIN_MAP;
+        deque->map = malloc(deque->map_capacity * sizeof(Block_T));
+        assert(deque->map != NULL);
+
+        deque->first = deque->map_capacity / 2;
+        deque->nblocks = 0;
+        deque->front = 0;
+        deque->size = 0;
+        deque->spare = NULL;
+
+        return deque;
+}
+
+void Deque_free(Deque_T *deque)
+{
+        Deque_T dq;
+        int b;
+
+        assert(deque != NULL);
+        assert(*deque != NULL);
+
+        dq = *deque;
+        for (b = dq->first; b < dq->first + dq->nblocks; b++)
+                free(dq->map[b]);
+        free(dq->spare);
+        free(dq->map);
+        free(dq);
+        *deque = NULL;
+}
+
+int Deque_length(Deque_T deque)
+{
+        assert(deque != NULL);
+
+        return deque->size;
+}
+
+void *Deque_get(Deque_T deque, int index)
+{
+        assert(deque != NULL);
+        assert(index >= 0 && index < deque->size);
+
+        return *deque_at(deque, deque->front + index);
+}
+
+void *Deque_first(Deque_T deque)
+{
+        assert(deque != NULL);
+
+        if (deque->size == 0)
+                return NULL;
+
+        return *deque_at(deque, deque->front);
+}
+
+void *Deque_last(Deque_T deque)
+{
+        assert(deque != NULL);
+
+        if (deque->size == 0)
+                return NULL;
+
+        return *deque_at(deque, deque->front + deque->size - 1);
+}
+
+void **Deque_slot(Deque_T deque, int index)
+{
+        assert(deque != NULL);
+        assert(index >= 0 && index < deque->size);
+
+        return deque_at(deque, deque->front + index);
+}
+
+void Deque_set(Deque_T deque, void *elem, int index)
+{
+        assert(deque != NULL);
+        assert(index >= 0 && index < deque->size);
+
+        *deque_at(deque, deque->front + index) = elem;
+}
+
+void Deque_append(Deque_T deque, void *elem)
+{
+        int pos;
+
+        assert(deque != NULL);
+        assert(deque->size < INT_MAX - BLOCK_SLOTS);
+
+        pos = deque->front + deque->size;
+        if (pos == deque->nblocks * BLOCK_SLOTS) {
+                deque_reserve(deque, false);
+                deque->map[deque->first + deque->nblocks] =
+                        deque_block_new(deque);
+                deque->nblocks++;
+        }
+
+        *deque_at(deque, pos) = elem;
+        deque->size++;
+}
+
+void Deque_prepend(Deque_T deque, void *elem)
+{
+        assert(deque != NULL);
+        assert(deque->size < INT_MAX - BLOCK_SLOTS);
+
+        if (deque->front == 0) {
+                deque_reserve(deque, true);
+                deque->first--;
+                deque->map[deque->first] = deque_block_new(deque);
+                deque->nblocks++;
+                deque->front = BLOCK_SLOTS;
+        }
+
+        deque->front--;
+        *deque_at(deque, deque->front) = elem;
+        deque->size++;
+}
+
+void Deque_removehi(Deque_T deque)
+{
+        assert(deque != NULL);
+        assert(deque->size > 0);
+
+        deque->size--;
+
+        /* release the last block once nothing is left in it */
+        if (deque->front + deque->size <= (deque->nblocks - 1) *
+            BLOCK_SLOTS) {
+                deque->nblocks--;
+                deque_block_release(deque,
+                                    deque->map[deque->first +
+                                               deque->nblocks]);
+        }
+
+        if (deque->size == 0 && deque->nblocks == 1) {
+                deque->nblocks = 0;
+                deque_block_release(deque, deque->map[deque->first]);
+        }
+        if (deque->nblocks == 0)
+                deque->front = 0;
+}
+
+void Deque_removelo(Deque_T deque)
+{
+        assert(deque != NULL);
+        assert(deque->size > 0);
+
+        deque->size--;
+        deque->front++;
+
+        if (deque->front == BLOCK_SLOTS || deque->size == 0) {
+                deque_block_release(deque, deque->map[deque->first]);
+                deque->first++;
+                deque->nblocks--;
+                deque->front = 0;
+        }
+}
+
+Iter_T Deque_iter(Deque_T deque)
+{
+        Iter_T iter;
+
+        assert(deque != NULL);
+
+        iter = Iter_func(deque_next, deque);
+        iter.remaining = deque->size;
+        if (deque->size > 0) {
+                iter.link = &deque->map[deque->first];
+                iter.pos = deque->map[deque->first] + deque->front;
+                iter.end = deque->map[deque->first] + BLOCK_SLOTS;
+        }
+
+        return iter;
+}
+
+/*-------------------------------------
+ * Helper/Private Definitions
+ -------------------------------------*/
+static inline void **deque_at(Deque_T deque, int pos)
+{
+        return &deque->map[deque->first + (pos >> BLOCK_SHIFT)]
+                          [pos & BLOCK_MASK];
+}
+
+static void deque_reserve(Deque_T deque, bool at_front)
+{
+        Block_T *map;
+        int capacity = deque->map_capacity;
+        int first;
+
+        if (at_front ? deque->first > 0 :
+                       deque->first + deque->nblocks < capacity)
+                return;
+
+        if (2 * deque->nblocks >= capacity) {
+                assert(capacity <= INT_MAX / 2);
+                capacity *= 2;
+                map = realloc(deque->map, capacity * sizeof(Block_T));
+                assert(map != NULL);
+                deque->map = map;
+                deque->map_capacity = capacity;
+        }
+
+        /* recenter, leaving the free entries split between both ends */
+        first = (capacity - deque->nblocks) / 2;
+        memmove(deque->map + first, deque->map + deque->first,
+                deque->nblocks * sizeof(Block_T));
+        deque->first = first;
+}
+
+static Block_T deque_block_new(Deque_T deque)
+{
+        Block_T block = deque->spare;
+
+        if (block != NULL) {
+                deque->spare = NULL;
+                return block;
+        }
+
+        block = malloc(BLOCK_SLOTS * sizeof(void *));
+        assert(block != NULL);
+
+        return block;
+}
+
+static void deque_block_release(Deque_T deque, Block_T block)
+{
+        if (deque->spare == NULL)
+                deque->spare = block;
+        else
+                free(block);
+}
+
+static bool deque_next(Iter_T *iter, void **elem)
+{
+        Block_T *link;
+
+        if (iter->remaining == 0)
+                return false;
+
+        if (iter->pos == iter->end) {
+                link = (Block_T *) iter->link + 1;
+                iter->link = link;
+                iter->pos = *link;
+                iter->end = *link + BLOCK_SLOTS;
+        }
+
+        *elem = *iter->pos++;
+        iter->remaining--;
+
+        return true;
+}
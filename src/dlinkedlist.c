@@ -26,6 +26,12 @@
 
 #include "dlinkedlist.h"
 
+/*-------------------------------------
+ * Constants
+ -------------------------------------*/
+/* Elements handed to free_batch at a time by DLinkedList_clear */
+#define CLEAR_BATCH 256
+
 /*-------------------------------------
  * Representation
  -------------------------------------*/
@@ -42,15 +48,20 @@ struct dlinkedlist_t {
         Node_T list_end;
         int capacity;
         int size;
+        Arena_T arena;
+        void (*free_elem)(void *elem, void *cl);
+        void (*free_batch)(void **elems, int length, void *cl);
+        void *free_cl;
 };
 
 /*-------------------------------------
  * Helper/Private Prototypes
  -------------------------------------*/
 /*
- * Mallocs and inits a new node
+ * Allocates a node from the node Pool, or from the list's Arena,
+ * and inits it
  */
-Node_T Node_new(Node_T prev, Node_T next, void *elem);
+Node_T Node_new(DLinkedList_T list, Node_T prev, Node_T next, void *elem);
 
 /*
  * Removes the current node from the list and frees it
@@ -92,6 +103,22 @@ Node_T split_search(DLinkedList_T list, int index);
  */
 void remove_node(DLinkedList_T list, Node_T curr);
 
+/*
+ * Destroys a run of elements as set up by DLinkedList_own. Helper
+ * to DLinkedList_clear
+ */
+static void free_elems(DLinkedList_T list, void **elems, int length);
+
+/*
+ * Describes the buffers of up to *remaining nodes from *node on as
+ * iovecs, merging adjacent buffers, and leaves *node and *remaining
+ * at the first node not described. Helper to DLinkedList_iovec and
+ * DLinkedList_writev
+ */
+static int node_iovec(Node_T *node, int *remaining, struct iovec *iov,
+                      int iovcnt, size_t length(void *elem, void *cl),
+                      void *cl);
+
 
 /*-------------------------------------
  * Debug Function Prototypes
@@ -108,14 +135,44 @@ DLinkedList_T DLinkedList_new(int hint)
         assert(hint >= 0);
         assert(hint < INT_MAX);
 
-        list = malloc(sizeof(struct dlinkedlist_t));
-        assert(list != NULL);
+        list = Pool_alloc(sizeof(struct dlinkedlist_t));
+
+        if (hint == 0)
+                hint++;
+
+        list->capacity = hint;
+        list->size = 0;
+        list->arena = NULL;
+        list->free_elem = NULL;
+        list->free_batch = NULL;
+        list->free_cl = NULL;
+        list->tail = NULL;
+        list->front = malloc_hint(list, hint);
+        list->list_start = list->front;
+        list->list_end = list->front;
+
+        return list;
+}
+
+DLinkedList_T DLinkedList_new_arena(int hint, Arena_T arena)
+{
+        DLinkedList_T list;
+
+        assert(hint >= 0);
+        assert(hint < INT_MAX);
+        assert(arena != NULL);
+
+        list = Arena_alloc(arena, sizeof(struct dlinkedlist_t), 0);
 
         if (hint == 0)
                 hint++;
 
         list->capacity = hint;
         list->size = 0;
+        list->arena = arena;
+        list->free_elem = NULL;
+        list->free_batch = NULL;
+        list->free_cl = NULL;
         list->tail = NULL;
         list->front = malloc_hint(list, hint);
         list->list_start = list->front;
@@ -129,6 +186,11 @@ void DLinkedList_free(DLinkedList_T *list)
         assert(list != NULL);
         assert(*list != NULL);
 
+        if ((*list)->arena != NULL) {
+                *list = NULL;
+                return;
+        }
+
         while((*list)->capacity > 0)
                 Node_free(*list, &((*list)->front));
 
@@ -137,7 +199,65 @@ void DLinkedList_free(DLinkedList_T *list)
         (*list)->list_start = NULL;
         (*list)->list_end = NULL;
 
-        free(*list);
+        Pool_free(*list, sizeof(struct dlinkedlist_t));
+        *list = NULL;
+}
+
+//////////////////////////////////
+//      Ownership Functions     //
+//////////////////////////////////
+void DLinkedList_own(DLinkedList_T list,
+                     void free_elem(void *elem, void *cl),
+                     void free_batch(void **elems, int length, void *cl),
+                     void *cl)
+{
+        assert(list != NULL);
+
+        list->free_elem = free_elem;
+        list->free_batch = free_batch;
+        list->free_cl = cl;
+}
+
+void DLinkedList_clear(DLinkedList_T *list)
+{
+        DLinkedList_T l;
+        Node_T node = NULL;
+        Node_T next = NULL;
+        void *batch[CLEAR_BATCH];
+        int nbatch = 0;
+        int remaining;
+        bool live = false;
+
+        assert(list != NULL);
+        assert(*list != NULL);
+
+        l = *list;
+        remaining = l->size;
+
+        /* elements and nodes are released in the same walk */
+        for (node = l->front; node != NULL; node = next) {
+                next = node->next;
+
+                if (node == l->list_start)
+                        live = true;
+
+                if (live && remaining > 0) {
+                        batch[nbatch++] = node->elem;
+                        remaining--;
+                        if (nbatch == CLEAR_BATCH) {
+                                free_elems(l, batch, nbatch);
+                                nbatch = 0;
+                        }
+                }
+
+                if (l->arena == NULL)
+                        Pool_free(node, sizeof(struct node_t));
+        }
+
+        free_elems(l, batch, nbatch);
+
+        if (l->arena == NULL)
+                Pool_free(l, sizeof(struct dlinkedlist_t));
         *list = NULL;
 }
 
@@ -215,9 +335,9 @@ void DLinkedList_append(DLinkedList_T list, void *elem)
         assert(list != NULL);
 
         if (list->size == 0) {
-                (list->tail)->elem = elem;
-        } else if (list->size == list->capacity) {
-                node = Node_new(list->tail, NULL, elem);
+                (list->list_end)->elem = elem;
+        } else if (list->list_end == list->tail) {
+                node = Node_new(list, list->tail, NULL, elem);
                 assert(node != NULL);
 
                 (list->tail)->next = node;
@@ -242,9 +362,9 @@ void DLinkedList_prepend(DLinkedList_T list, void *elem)
         assert(list != NULL);
 
         if (list->size == 0) {
-                (list->front)->elem = elem;
-        } else if (list->size == list->capacity) {
-                node = Node_new(NULL, list->front, elem);
+                (list->list_start)->elem = elem;
+        } else if (list->list_start == list->front) {
+                node = Node_new(list, NULL, list->front, elem);
                 assert(node != NULL);
 
                 (list->front)->prev = node;
@@ -280,15 +400,138 @@ void DLinkedList_removelo(DLinkedList_T list)
         (void) list;
 }
 
+//////////////////////////////////
+//      Iteration Functions     //
+//////////////////////////////////
+Iter_T DLinkedList_iter(DLinkedList_T list)
+{
+        assert(list != NULL);
+
+        return Iter_linked(list->list_start, list->size,
+                           offsetof(struct node_t, elem),
+                           offsetof(struct node_t, next));
+}
+
+//////////////////////////////////
+//      Stream Functions        //
+//////////////////////////////////
+bool DLinkedList_write(DLinkedList_T list, FILE *fp,
+                       const Serial_Codec_T *codec)
+{
+        Serial_Writer_T writer;
+        Node_T node = NULL;
+        int i;
+
+        assert(list != NULL);
+
+        writer = Serial_writer_new(fp, codec);
+
+        node = list->list_start;
+        for (i = 0; i < list->size; i++, node = node->next)
+                if (!Serial_write(writer, node->elem))
+                        break;
+
+        return Serial_writer_free(&writer);
+}
+
+DLinkedList_T DLinkedList_read(FILE *fp, const Serial_Codec_T *codec)
+{
+        Serial_Reader_T reader;
+        DLinkedList_T list;
+        void *elem;
+
+        reader = Serial_reader_new(fp, codec);
+        if (reader == NULL)
+                return NULL;
+
+        list = DLinkedList_new(0);
+        while (Serial_read(reader, &elem))
+                DLinkedList_append(list, elem);
+
+        if (Serial_reader_failed(reader)) {
+                if (codec->free != NULL) {
+                        DLinkedList_own(list, codec->free, NULL, codec->cl);
+                        DLinkedList_clear(&list);
+                } else {
+                        DLinkedList_free(&list);
+                }
+        }
+
+        Serial_reader_free(&reader);
+
+        return list;
+}
+
+//////////////////////////////////
+//      Gather Functions        //
+//////////////////////////////////
+int DLinkedList_iovec(DLinkedList_T list, int *index, struct iovec *iov,
+                      int iovcnt, size_t length(void *elem, void *cl),
+                      void *cl)
+{
+        Node_T node = NULL;
+        int remaining;
+        int count;
+
+        assert(list != NULL);
+        assert(index != NULL);
+        assert(*index >= 0 && *index <= list->size);
+        assert(iov != NULL && iovcnt > 0);
+        assert(length != NULL);
+
+        if (*index == list->size)
+                return 0;
+
+        node = split_search(list, *index);
+        remaining = list->size - *index;
+        count = node_iovec(&node, &remaining, iov, iovcnt, length, cl);
+        *index = list->size - remaining;
+
+        return count;
+}
+
+ssize_t DLinkedList_writev(DLinkedList_T list, int fd,
+                           size_t length(void *elem, void *cl), void *cl)
+{
+        struct iovec iov[SERIAL_IOV_MAX];
+        Node_T node = NULL;
+        ssize_t total = 0;
+        ssize_t n;
+        int remaining;
+        int count;
+
+        assert(list != NULL);
+        assert(length != NULL);
+
+        node = list->list_start;
+        remaining = list->size;
+        while (remaining > 0) {
+                count = node_iovec(&node, &remaining, iov, SERIAL_IOV_MAX,
+                                   length, cl);
+                n = Serial_writev(fd, iov, count);
+                if (n < 0)
+                        return -1;
+                total += n;
+        }
+
+        return total;
+}
+
 /*-------------------------------------
  * Helper/Private Definitions
  -------------------------------------*/
-Node_T Node_new(Node_T prev, Node_T next, void *elem)
+Node_T Node_new(DLinkedList_T list, Node_T prev, Node_T next, void *elem)
 {
         Node_T node = NULL;
 
-        node = malloc(sizeof(struct node_t));
-        assert(node != NULL);
+        assert(list != NULL);
+
+        if (list->arena != NULL) {
+                node = Arena_alloc(list->arena, sizeof(struct node_t),
+                                   sizeof(void *));
+        } else {
+                node = Pool_alloc(sizeof(struct node_t));
+        }
 
         node->elem = elem;
         node->prev = prev;
@@ -331,7 +574,8 @@ void Node_free(DLinkedList_T list, Node_T *curr)
         temp->elem = NULL;
         temp->next = NULL;
         temp->prev = NULL;
-        free(temp);
+        if (list->arena == NULL)
+                Pool_free(temp, sizeof(struct node_t));
         temp = NULL;
 }
 
@@ -345,14 +589,14 @@ Node_T malloc_hint(DLinkedList_T list, int hint)
         assert(hint >= 0);
         assert(hint < INT_MAX);
 
-        node = Node_new(NULL, NULL, NULL);
+        node = Node_new(list, NULL, NULL, NULL);
         assert(node != NULL);
 
         list->tail = node;
         
         if (hint > 1) {
                 for (i = hint - 2; i >= 0; i--) {
-                        temp = Node_new(NULL, node, NULL);
+                        temp = Node_new(list, NULL, node, NULL);
                         assert(temp != NULL);
 
                         node->prev = temp;
@@ -421,6 +665,63 @@ void remove_node(DLinkedList_T list, Node_T curr)
         list->size--;
 }
 
+static void free_elems(DLinkedList_T list, void **elems, int length)
+{
+        int i;
+
+        assert(list != NULL);
+        assert(length >= 0);
+
+        if (length == 0)
+                return;
+
+        if (list->free_batch != NULL) {
+                list->free_batch(elems, length, list->free_cl);
+        } else if (list->free_elem != NULL) {
+                for (i = 0; i < length; i++)
+                        if (elems[i] != NULL)
+                                list->free_elem(elems[i], list->free_cl);
+        } else {
+                for (i = 0; i < length; i++)
+                        free(elems[i]);
+        }
+}
+
+static int node_iovec(Node_T *node, int *remaining, struct iovec *iov,
+                      int iovcnt, size_t length(void *elem, void *cl),
+                      void *cl)
+{
+        struct iovec *last = NULL;
+        Node_T curr = *node;
+        char *base;
+        size_t len;
+        int count = 0;
+
+        for (; *remaining > 0; (*remaining)--, curr = curr->next) {
+                base = curr->elem;
+                len = length(base, cl);
+                if (len == 0)
+                        continue;
+
+                if (last != NULL &&
+                    (char *) last->iov_base + last->iov_len == base) {
+                        last->iov_len += len;
+                        continue;
+                }
+
+                if (count == iovcnt)
+                        break;
+
+                last = &iov[count++];
+                last->iov_base = base;
+                last->iov_len = len;
+        }
+
+        *node = curr;
+
+        return count;
+}
+
 /*-------------------------------------
  * Debug Function Definitions
  -------------------------------------*/
@@ -451,3 +752,4 @@ void print(DLinkedList_T list)
         fprintf(stderr, "========= End Printing =========\n");
 
 }
+
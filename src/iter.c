@@ -0,0 +1,290 @@
+/*
+ *      filename:       iter.c
+ *      author:         @keiferchiang
+ *      date:           18 Oct 2026
+ *      version:        0.0.1
+ *
+ *      description:    Implementation of the Iter module
+ */
+
+#include "iter.h"
+
+/*-------------------------------------
+ * Globals
+ -------------------------------------*/
+/* Starting point for every constructor; all fields zero or NULL */
+static const Iter_T empty_iter;
+
+/*-------------------------------------
+ * Helper/Private Prototypes
+ -------------------------------------*/
+/*
+ * next functions of the adapters
+ */
+static bool map_next(Iter_T *iter, void **elem);
+static bool filter_next(Iter_T *iter, void **elem);
+static bool take_next(Iter_T *iter, void **elem);
+static bool zip_next(Iter_T *iter, void **elem);
+static bool chain_next(Iter_T *iter, void **elem);
+
+/*
+ * Returns a function-kind iterator pulling from src and other
+ */
+static inline Iter_T adapter_new(bool next(Iter_T *iter, void **elem),
+                                 Iter_T *src, Iter_T *other, void *cl);
+
+/*-------------------------------------
+ * Function Definitions
+ -------------------------------------*/
+//////////////////////////////////
+//      Constructors            //
+//////////////////////////////////
+Iter_T Iter_array(void **array, int length)
+{
+        Iter_T iter = empty_iter;
+
+        assert(array != NULL || length == 0);
+        assert(length >= 0);
+
+        iter.kind = ITER_ARRAY;
+        iter.pos = array;
+        iter.end = array + length;
+
+        return iter;
+}
+
+Iter_T Iter_linked(void *first, int length, size_t elem_off,
+                   size_t next_off)
+{
+        Iter_T iter = empty_iter;
+
+        assert(first != NULL || length == 0);
+        assert(length >= 0);
+
+        iter.kind = ITER_LINKED;
+        iter.link = first;
+        iter.remaining = length;
+        iter.elem_off = elem_off;
+        iter.next_off = next_off;
+
+        return iter;
+}
+
+Iter_T Iter_func(bool next(Iter_T *iter, void **elem), void *state)
+{
+        Iter_T iter = empty_iter;
+
+        assert(next != NULL);
+
+        iter.kind = ITER_FUNC;
+        iter.next = next;
+        iter.state = state;
+
+        return iter;
+}
+
+//////////////////////////////////
+//      Adapters                //
+//////////////////////////////////
+Iter_T Iter_map(Iter_T *src, void *map(void *elem, void *cl), void *cl)
+{
+        Iter_T iter;
+
+        assert(src != NULL);
+        assert(map != NULL);
+
+        iter = adapter_new(map_next, src, NULL, cl);
+        iter.fn.map = map;
+
+        return iter;
+}
+
+Iter_T Iter_filter(Iter_T *src, bool pred(void *elem, void *cl), void *cl)
+{
+        Iter_T iter;
+
+        assert(src != NULL);
+        assert(pred != NULL);
+
+        iter = adapter_new(filter_next, src, NULL, cl);
+        iter.fn.pred = pred;
+
+        return iter;
+}
+
+Iter_T Iter_take(Iter_T *src, int n)
+{
+        Iter_T iter;
+
+        assert(src != NULL);
+        assert(n >= 0);
+
+        iter = adapter_new(take_next, src, NULL, NULL);
+        iter.remaining = n;
+
+        return iter;
+}
+
+Iter_T Iter_zip(Iter_T *first, Iter_T *second,
+                void *combine(void *a, void *b, void *cl), void *cl)
+{
+        Iter_T iter;
+
+        assert(first != NULL && second != NULL);
+        assert(combine != NULL);
+
+        iter = adapter_new(zip_next, first, second, cl);
+        iter.fn.combine = combine;
+
+        return iter;
+}
+
+Iter_T Iter_chain(Iter_T *first, Iter_T *second)
+{
+        assert(first != NULL && second != NULL);
+
+        return adapter_new(chain_next, first, second, NULL);
+}
+
+//////////////////////////////////
+//      Algorithms              //
+//////////////////////////////////
+bool Iter_find(Iter_T *iter, bool pred(void *elem, void *cl), void *cl,
+               void **elem)
+{
+        void *curr;
+
+        assert(iter != NULL);
+        assert(pred != NULL);
+
+        while (Iter_next(iter, &curr)) {
+                if (pred(curr, cl)) {
+                        if (elem != NULL)
+                                *elem = curr;
+                        return true;
+                }
+        }
+
+        return false;
+}
+
+void Iter_apply(Iter_T *iter, void apply(void *elem, void *cl), void *cl)
+{
+        void *curr;
+
+        assert(iter != NULL);
+        assert(apply != NULL);
+
+        while (Iter_next(iter, &curr))
+                apply(curr, cl);
+}
+
+void *Iter_reduce(Iter_T *iter, void *accum,
+                  void *reduce(void *accum, void *elem, void *cl), void *cl)
+{
+        void *curr;
+
+        assert(iter != NULL);
+        assert(reduce != NULL);
+
+        while (Iter_next(iter, &curr))
+                accum = reduce(accum, curr, cl);
+
+        return accum;
+}
+
+long Iter_count(Iter_T *iter)
+{
+        void *curr;
+        long count = 0;
+
+        assert(iter != NULL);
+
+        if (iter->kind == ITER_ARRAY) {
+                count = iter->end - iter->pos;
+                iter->pos = iter->end;
+                return count;
+        }
+
+        while (Iter_next(iter, &curr))
+                count++;
+
+        return count;
+}
+
+/*-------------------------------------
+ * Helper/Private Definitions
+ -------------------------------------*/
+static bool map_next(Iter_T *iter, void **elem)
+{
+        void *curr;
+
+        if (!Iter_next(iter->src, &curr))
+                return false;
+
+        *elem = iter->fn.map(curr, iter->cl);
+
+        return true;
+}
+
+static bool filter_next(Iter_T *iter, void **elem)
+{
+        void *curr;
+
+        while (Iter_next(iter->src, &curr)) {
+                if (iter->fn.pred(curr, iter->cl)) {
+                        *elem = curr;
+                        return true;
+                }
+        }
+
+        return false;
+}
+
+static bool take_next(Iter_T *iter, void **elem)
+{
+        if (iter->remaining == 0 || !Iter_next(iter->src, elem))
+                return false;
+
+        iter->remaining--;
+
+        return true;
+}
+
+static bool zip_next(Iter_T *iter, void **elem)
+{
+        void *a, *b;
+
+        /* peek first so neither side loses an element at the end */
+        if (!Iter_peek(iter->src, &a) || !Iter_peek(iter->other, &b))
+                return false;
+
+        Iter_next(iter->src, &a);
+        Iter_next(iter->other, &b);
+        *elem = iter->fn.combine(a, b, iter->cl);
+
+        return true;
+}
+
+static bool chain_next(Iter_T *iter, void **elem)
+{
+        if (iter->src != NULL) {
+                if (Iter_next(iter->src, elem))
+                        return true;
+                iter->src = NULL;
+        }
+
+        return Iter_next(iter->other, elem);
+}
+
+static inline Iter_T adapter_new(bool next(Iter_T *iter, void **elem),
+                                 Iter_T *src, Iter_T *other, void *cl)
+{
+        Iter_T iter = Iter_func(next, NULL);
+
+        iter.src = src;
+        iter.other = other;
+        iter.cl = cl;
+
+        return iter;
+}
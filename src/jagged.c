@@ -0,0 +1,240 @@
+/*
+ *      filename:       jagged.c
+ *      author:         @keiferchiang
+ *      date:           18 Oct 2026
+ *      version:        0.0.1
+ *
+ *      description:    Implementation of the Jagged module
+ *
+ *      note:           Row i spans values[offsets[i], offsets[i + 1]).
+ *                      offsets always holds rows + 1 entries with
+ *                      offsets[0] == 0, so pushing to the last row
+ *                      only bumps offsets[rows].
+ *
+ *      design:         offsets [ 0 | 2 | 2 | 5 ]
+ *                      values  [ a b | | c d e ]
+ */
+
+#include "jagged.h"
+
+/*-------------------------------------
+ * Constants
+ -------------------------------------*/
+#define MIN_CAPACITY    8
+
+/*-------------------------------------
+ * Representation
+ -------------------------------------*/
+struct jagged_t {
+        void **values;
+        int64_t *offsets;
+        int64_t capacity;
+        int rows;
+        int row_capacity;
+        bool frozen;
+};
+
+/*-------------------------------------
+ * Helper/Private Prototypes
+ -------------------------------------*/
+/*
+ * Ensures room for at least need values
+ */
+static void jagged_reserve(Jagged_T jag, int64_t need);
+
+/*-------------------------------------
+ * Function Definitions
+ -------------------------------------*/
+Jagged_T Jagged_new(int rows, int64_t values)
+{
+        Jagged_T jag;
+
+        assert(rows >= 0);
+        assert(rows < INT_MAX);
+        assert(values >= 0);
+
+        jag = malloc(sizeof(struct jagged_t));
+        assert(jag != NULL);
+
+        jag->capacity = values > MIN_CAPACITY ? values : MIN_CAPACITY;
+        jag->values = malloc(jag->capacity * sizeof(void *));
+        assert(jag->values != NULL);
+
+        jag->row_capacity = rows > MIN_CAPACITY ? rows : MIN_CAPACITY;
+        jag->offsets = malloc((jag->row_capacity + (size_t) 1) *
+                              sizeof(int64_t));
+        assert(jag->offsets != NULL);
+        jag->offsets[0] = 0;
+
+        jag->rows = 0;
+        jag->frozen = false;
+
+        return jag;
+}
+
+void Jagged_free(Jagged_T *jag)
+{
+        assert(jag != NULL);
+        assert(*jag != NULL);
+
+        free((*jag)->values);
+        free((*jag)->offsets);
+        free(*jag);
+        *jag = NULL;
+}
+
+int Jagged_add_row(Jagged_T jag)
+{
+        int64_t *offsets;
+
+        assert(jag != NULL);
+        assert(!jag->frozen);
+        assert(jag->rows < INT_MAX - 1);
+
+        if (jag->rows == jag->row_capacity) {
+                jag->row_capacity = jag->row_capacity < INT_MAX / 2 ?
+                                    2 * jag->row_capacity : INT_MAX - 1;
+                offsets = realloc(jag->offsets, (jag->row_capacity +
+                                  (size_t) 1) * sizeof(int64_t));
+                assert(offsets != NULL);
+                jag->offsets = offsets;
+        }
+
+        jag->offsets[jag->rows + 1] = jag->offsets[jag->rows];
+
+        return jag->rows++;
+}
+
+void Jagged_push(Jagged_T jag, void *elem)
+{
+        int64_t end;
+
+        assert(jag != NULL);
+        assert(jag->rows > 0);
+        assert(!jag->frozen);
+
+        end = jag->offsets[jag->rows];
+        assert(end - jag->offsets[jag->rows - 1] < INT_MAX);
+
+        if (end == jag->capacity)
+                jagged_reserve(jag, end + 1);
+
+        jag->values[end] = elem;
+        jag->offsets[jag->rows] = end + 1;
+}
+
+int Jagged_append_row(Jagged_T jag, Vector_T vec)
+{
+        int64_t end;
+        int length;
+        int row;
+
+        assert(jag != NULL);
+        assert(vec != NULL);
+
+        row = Jagged_add_row(jag);
+        length = Vector_length(vec);
+        end = jag->offsets[row];
+
+        jagged_reserve(jag, end + length);
+        if (length > 0)
+                memcpy(jag->values + end, Vector_data(vec),
+                       length * sizeof(void *));
+        jag->offsets[row + 1] = end + length;
+
+        return row;
+}
+
+void Jagged_freeze(Jagged_T jag)
+{
+        void **values;
+        int64_t *offsets;
+        int64_t length;
+
+        assert(jag != NULL);
+
+        length = jag->offsets[jag->rows];
+        jag->capacity = length > 0 ? length : 1;
+        values = realloc(jag->values, jag->capacity * sizeof(void *));
+        if (values != NULL) //shrinking: keep the old block on failure
+                jag->values = values;
+
+        jag->row_capacity = jag->rows;
+        offsets = realloc(jag->offsets, (jag->rows + (size_t) 1) *
+                          sizeof(int64_t));
+        if (offsets != NULL)
+                jag->offsets = offsets;
+
+        jag->frozen = true;
+}
+
+void **Jagged_row(Jagged_T jag, int row, int *length)
+{
+        assert(jag != NULL);
+        assert(row >= 0 && row < jag->rows);
+
+        if (length != NULL)
+                *length = (int) (jag->offsets[row + 1] - jag->offsets[row]);
+
+        return jag->values + jag->offsets[row];
+}
+
+int Jagged_row_length(Jagged_T jag, int row)
+{
+        assert(jag != NULL);
+        assert(row >= 0 && row < jag->rows);
+
+        return (int) (jag->offsets[row + 1] - jag->offsets[row]);
+}
+
+void *Jagged_get(Jagged_T jag, int row, int col)
+{
+        assert(jag != NULL);
+        assert(row >= 0 && row < jag->rows);
+        assert(col >= 0 && col < jag->offsets[row + 1] - jag->offsets[row]);
+
+        return jag->values[jag->offsets[row] + col];
+}
+
+void Jagged_set(Jagged_T jag, void *elem, int row, int col)
+{
+        assert(jag != NULL);
+        assert(row >= 0 && row < jag->rows);
+        assert(col >= 0 && col < jag->offsets[row + 1] - jag->offsets[row]);
+
+        jag->values[jag->offsets[row] + col] = elem;
+}
+
+int Jagged_rows(Jagged_T jag)
+{
+        assert(jag != NULL);
+
+        return jag->rows;
+}
+
+int64_t Jagged_length(Jagged_T jag)
+{
+        assert(jag != NULL);
+
+        return jag->offsets[jag->rows];
+}
+
+/*-------------------------------------
+ * Helper/Private Definitions
+ -------------------------------------*/
+static void jagged_reserve(Jagged_T jag, int64_t need)
+{
+        void **values;
+        int64_t capacity = jag->capacity;
+
+        if (need <= capacity)
+                return;
+
+        while (capacity < need)
+                capacity *= 2;
+
+        values = realloc(jag->values, capacity * sizeof(void *));
+        assert(values != NULL);
+        jag->values = values;
+        jag->capacity = capacity;
+}
@@ -0,0 +1,302 @@
+/*
+ *      filename:       minmaxheap.c
+ *      author:         @keiferchiang
+ *      date:           18 Oct 2026
+ *      version:        0.0.1
+ *
+ *      description:    Implementation of the MinMaxHeap module
+ *
+ *      note:           Atkinson et al.'s min-max heap: a complete
+ *                      binary tree in array order whose even levels
+ *                      (the root's among them) are min levels and odd
+ *                      levels max levels. A node on a min level is no
+ *                      greater than anything below it, and a node on
+ *                      a max level no less, so the minimum is the root
+ *                      and the maximum one of its two children.
+ *
+ *                      Sifting compares against grandparents and
+ *                      grandchildren, which sit on levels of the same
+ *                      kind, so each step climbs or descends two
+ *                      levels and a path costs about as many
+ *                      comparisons as in a binary heap.
+ */
+
+#include "minmaxheap.h"
+
+/*-------------------------------------
+ * Representation
+ -------------------------------------*/
+struct minmaxheap_t {
+        Vector_T elems;
+        int (*cmp)(void *a, void *b, void *cl);
+        void *cl;
+};
+
+/*-------------------------------------
+ * Helper/Private Prototypes
+ -------------------------------------*/
+/*
+ * Returns true if index i is on a min level
+ */
+static inline bool mmheap_min_level(int i);
+
+/*
+ * Returns true if a belongs above b on a min level, or on a max
+ * level when max
+ */
+static inline bool mmheap_before(MinMaxHeap_T heap, void *a, void *b,
+                                 bool max);
+
+/*
+ * Exchanges the elements at i and j
+ */
+static inline void mmheap_swap(void **array, int i, int j);
+
+/*
+ * Moves the element at i up through the grandparents on its own
+ * kind of level
+ */
+static void mmheap_bubble_up(MinMaxHeap_T heap, int i, bool max);
+
+/*
+ * Moves the element at i down until it satisfies its level
+ */
+static void mmheap_trickle_down(MinMaxHeap_T heap, int i);
+
+/*
+ * Removes the element at i, refilling the hole from the last slot
+ */
+static void *mmheap_take(MinMaxHeap_T heap, int i);
+
+/*-------------------------------------
+ * Function Definitions
+ -------------------------------------*/
+MinMaxHeap_T MinMaxHeap_new(int hint, int cmp(void *a, void *b, void *cl),
+                            void *cl)
+{
+        MinMaxHeap_T heap;
+
+        assert(hint >= 0);
+        assert(hint < INT_MAX);
+        assert(cmp != NULL);
+
+        heap = malloc(sizeof(struct minmaxheap_t));
+        assert(heap != NULL);
+
+        heap->elems = Vector_new(hint);
+        heap->cmp = cmp;
+        heap->cl = cl;
+
+        return heap;
+}
+
+void MinMaxHeap_free(MinMaxHeap_T *heap)
+{
+        assert(heap != NULL);
+        assert(*heap != NULL);
+
+        Vector_free(&(*heap)->elems);
+        free(*heap);
+        *heap = NULL;
+}
+
+void MinMaxHeap_push(MinMaxHeap_T heap, void *elem)
+{
+        void **array;
+        int i;
+        int parent;
+
+        assert(heap != NULL);
+
+        Vector_append(heap->elems, elem);
+        i = Vector_length(heap->elems) - 1;
+        if (i == 0)
+                return;
+
+        /*
+         * elem either belongs on its own kind of level, or is beyond
+         * its parent and belongs on the parent's kind instead
+         */
+        array = Vector_data(heap->elems);
+        parent = (i - 1) / 2;
+        if (mmheap_min_level(i)) {
+                if (mmheap_before(heap, elem, array[parent], true)) {
+                        mmheap_swap(array, i, parent);
+                        mmheap_bubble_up(heap, parent, true);
+                } else {
+                        mmheap_bubble_up(heap, i, false);
+                }
+        } else {
+                if (mmheap_before(heap, elem, array[parent], false)) {
+                        mmheap_swap(array, i, parent);
+                        mmheap_bubble_up(heap, parent, false);
+                } else {
+                        mmheap_bubble_up(heap, i, true);
+                }
+        }
+}
+
+void *MinMaxHeap_min(MinMaxHeap_T heap)
+{
+        assert(heap != NULL);
+        assert(Vector_length(heap->elems) > 0);
+
+        return Vector_data(heap->elems)[0];
+}
+
+void *MinMaxHeap_max(MinMaxHeap_T heap)
+{
+        void **array;
+        int n;
+
+        assert(heap != NULL);
+
+        n = Vector_length(heap->elems);
+        assert(n > 0);
+
+        array = Vector_data(heap->elems);
+        if (n == 1)
+                return array[0];
+        if (n == 2 || heap->cmp(array[1], array[2], heap->cl) >= 0)
+                return array[1];
+
+        return array[2];
+}
+
+void *MinMaxHeap_pop_min(MinMaxHeap_T heap)
+{
+        assert(heap != NULL);
+        assert(Vector_length(heap->elems) > 0);
+
+        return mmheap_take(heap, 0);
+}
+
+void *MinMaxHeap_pop_max(MinMaxHeap_T heap)
+{
+        void **array;
+        int n;
+
+        assert(heap != NULL);
+
+        n = Vector_length(heap->elems);
+        assert(n > 0);
+
+        array = Vector_data(heap->elems);
+        if (n == 1)
+                return mmheap_take(heap, 0);
+        if (n == 2 || heap->cmp(array[1], array[2], heap->cl) >= 0)
+                return mmheap_take(heap, 1);
+
+        return mmheap_take(heap, 2);
+}
+
+int MinMaxHeap_length(MinMaxHeap_T heap)
+{
+        assert(heap != NULL);
+
+        return Vector_length(heap->elems);
+}
+
+Iter_T MinMaxHeap_iter(MinMaxHeap_T heap)
+{
+        assert(heap != NULL);
+
+        return Vector_iter(heap->elems);
+}
+
+/*-------------------------------------
+ * Helper/Private Definitions
+ -------------------------------------*/
+static inline bool mmheap_min_level(int i)
+{
+        unsigned n = (unsigned) i + 1;
+        int level = 0;
+
+        while (n >>= 1)
+                level++;
+
+        return level % 2 == 0;
+}
+
+static inline bool mmheap_before(MinMaxHeap_T heap, void *a, void *b,
+                                 bool max)
+{
+        int c = heap->cmp(a, b, heap->cl);
+
+        return max ? c > 0 : c < 0;
+}
+
+static inline void mmheap_swap(void **array, int i, int j)
+{
+        void *tmp = array[i];
+
+        array[i] = array[j];
+        array[j] = tmp;
+}
+
+static void mmheap_bubble_up(MinMaxHeap_T heap, int i, bool max)
+{
+        void **array = Vector_data(heap->elems);
+        int grandparent;
+
+        while (i >= 3) {
+                grandparent = ((i - 1) / 2 - 1) / 2;
+                if (!mmheap_before(heap, array[i], array[grandparent],
+                                   max))
+                        break;
+                mmheap_swap(array, i, grandparent);
+                i = grandparent;
+        }
+}
+
+static void mmheap_trickle_down(MinMaxHeap_T heap, int i)
+{
+        void **array = Vector_data(heap->elems);
+        int n = Vector_length(heap->elems);
+        bool max = !mmheap_min_level(i);
+        int first;
+        int best;
+        int j;
+
+        for (;;) {
+                first = 2 * i + 1;
+                if (first >= n)
+                        return;
+
+                /* best of the children and grandchildren */
+                best = first;
+                if (first + 1 < n &&
+                    mmheap_before(heap, array[first + 1], array[best], max))
+                        best = first + 1;
+                for (j = 2 * first + 1; j < 2 * first + 5 && j < n; j++)
+                        if (mmheap_before(heap, array[j], array[best], max))
+                                best = j;
+
+                if (!mmheap_before(heap, array[best], array[i], max))
+                        return;
+
+                mmheap_swap(array, i, best);
+                if (best <= first + 1) //a child: nothing below to fix
+                        return;
+
+                /* the displaced element may now beat its parent */
+                if (mmheap_before(heap, array[(best - 1) / 2], array[best],
+                                  max))
+                        mmheap_swap(array, best, (best - 1) / 2);
+                i = best;
+        }
+}
+
+static void *mmheap_take(MinMaxHeap_T heap, int i)
+{
+        void **array = Vector_data(heap->elems);
+        void *elem = array[i];
+        int last = Vector_length(heap->elems) - 1;
+
+        array[i] = array[last];
+        Vector_removehi(heap->elems);
+        if (i < last)
+                mmheap_trickle_down(heap, i);
+
+        return elem;
+}
@@ -0,0 +1,359 @@
+/*
+ *      filename:       pool.c
+ *      author:         @keiferchiang
+ *      date:           18 Oct 2026
+ *      version:        0.0.1
+ *
+ *      description:    Implementation of the Pool module
+ *
+ *      note:           Follows Bonwick's magazine allocator. Every
+ *                      thread keeps two magazines (stacks of free
+ *                      objects) per size class, so alloc and free are
+ *                      a push or pop on thread-local memory. When both
+ *                      run dry or fill up, a whole magazine is traded
+ *                      with the depot. The depot is a pair of Treiber
+ *                      stacks per size class. Magazines are never
+ *                      freed and are addressed by index, so each stack
+ *                      head packs an ABA tag next to the index in one
+ *                      64-bit word.
+ *
+ *                      The first time a thread takes a magazine it
+ *                      registers a pthread key whose destructor runs
+ *                      Pool_flush, so magazines are not lost with
+ *                      threads that exit without flushing.
+ *
+ *      design:         thread cache       depot (per size class)
+ *                      [ loaded   ]  <->  full:  [m] -> [m] -> 0
+ *                      [ previous ]  <->  empty: [m] -> 0
+ */
+
+#include <stdint.h>
+#include <pthread.h>
+
+#include "pool.h"
+
+/*-------------------------------------
+ * Constants
+ -------------------------------------*/
+#define CLASS_SIZE      16
+#define NCLASSES        (POOL_MAX_SIZE / CLASS_SIZE)
+#define MAG_SIZE        64
+#define MAX_MAGS        65536
+
+/*-------------------------------------
+ * Representation
+ -------------------------------------*/
+typedef struct magazine_t {
+        uint32_t next;
+        uint32_t index;
+        int count;
+        void *objs[MAG_SIZE];
+} *Magazine_T;
+
+/*
+ * Stack heads hold (tag << 32) | (index + 1); an index of 0 is the
+ * empty stack
+ */
+typedef struct depot_t {
+        uint64_t full;
+        uint64_t empty;
+} Depot_T;
+
+typedef struct cache_t {
+        Magazine_T loaded;
+        Magazine_T previous;
+} Cache_T;
+
+/*-------------------------------------
+ * Globals
+ -------------------------------------*/
+static Magazine_T magazines[MAX_MAGS];
+static uint32_t nmagazines = 0;
+static Depot_T depots[NCLASSES];
+static __thread Cache_T caches[NCLASSES];
+static __thread bool cache_registered = false;
+static pthread_key_t cache_key;
+static pthread_once_t cache_key_once = PTHREAD_ONCE_INIT;
+
+/*-------------------------------------
+ * Helper/Private Prototypes
+ -------------------------------------*/
+/*
+ * Returns an empty magazine from the depot, or a new one. Returns
+ * NULL once MAX_MAGS magazines exist
+ */
+static Magazine_T magazine_get(int cls);
+
+/*
+ * Lock-free push of mag onto the depot stack at head
+ */
+static void depot_push(uint64_t *head, Magazine_T mag);
+
+/*
+ * Lock-free pop from the depot stack at head. Returns NULL if the
+ * stack is empty
+ */
+static Magazine_T depot_pop(uint64_t *head);
+
+/*
+ * Arranges for the calling thread's cache to be flushed when it
+ * exits. Called whenever the thread takes a magazine
+ */
+static void cache_register(void);
+
+/*
+ * pthread_once and pthread key destructor callbacks for
+ * cache_register
+ */
+static void cache_key_init(void);
+static void cache_exit(void *arg);
+
+/*
+ * Returns the size class of an object of size bytes
+ */
+static inline int size_class(size_t size);
+
+/*-------------------------------------
+ * Function Definitions
+ -------------------------------------*/
+void *Pool_alloc(size_t size)
+{
+        Cache_T *cache;
+        Magazine_T full;
+        Magazine_T temp;
+        void *ptr;
+        int cls;
+
+        if (size > POOL_MAX_SIZE) {
+                ptr = malloc(size);
+                assert(ptr != NULL);
+                return ptr;
+        }
+
+        cls = size_class(size);
+        cache = &caches[cls];
+
+        if (cache->loaded != NULL && cache->loaded->count > 0)
+                return cache->loaded->objs[--cache->loaded->count];
+
+        if (cache->previous != NULL && cache->previous->count > 0) {
+                temp = cache->loaded;
+                cache->loaded = cache->previous;
+                cache->previous = temp;
+                return cache->loaded->objs[--cache->loaded->count];
+        }
+
+        full = depot_pop(&depots[cls].full);
+        if (full != NULL) {
+                cache_register();
+                if (cache->previous != NULL)
+                        depot_push(&depots[cls].empty, cache->previous);
+                cache->previous = cache->loaded;
+                cache->loaded = full;
+                return cache->loaded->objs[--cache->loaded->count];
+        }
+
+        ptr = malloc((cls + 1) * CLASS_SIZE);
+        assert(ptr != NULL);
+
+        return ptr;
+}
+
+void Pool_free(void *ptr, size_t size)
+{
+        Cache_T *cache;
+        Magazine_T empty;
+        Magazine_T temp;
+        int cls;
+
+        assert(ptr != NULL);
+
+        if (size > POOL_MAX_SIZE) {
+                free(ptr);
+                return;
+        }
+
+        cls = size_class(size);
+        cache = &caches[cls];
+
+        if (cache->loaded == NULL) {
+                cache_register();
+                cache->loaded = magazine_get(cls);
+        }
+
+        if (cache->loaded == NULL) {
+                free(ptr);
+                return;
+        }
+
+        if (cache->loaded->count < MAG_SIZE) {
+                cache->loaded->objs[cache->loaded->count++] = ptr;
+                return;
+        }
+
+        if (cache->previous != NULL && cache->previous->count == 0) {
+                temp = cache->loaded;
+                cache->loaded = cache->previous;
+                cache->previous = temp;
+                cache->loaded->objs[cache->loaded->count++] = ptr;
+                return;
+        }
+
+        empty = magazine_get(cls);
+        if (empty == NULL) {
+                free(ptr);
+                return;
+        }
+
+        if (cache->previous != NULL)
+                depot_push(&depots[cls].full, cache->previous);
+        cache->previous = cache->loaded;
+        cache->loaded = empty;
+        cache->loaded->objs[cache->loaded->count++] = ptr;
+}
+
+void Pool_flush(void)
+{
+        Magazine_T mags[2];
+        int cls;
+        int i;
+
+        for (cls = 0; cls < NCLASSES; cls++) {
+                mags[0] = caches[cls].loaded;
+                mags[1] = caches[cls].previous;
+                caches[cls].loaded = NULL;
+                caches[cls].previous = NULL;
+
+                for (i = 0; i < 2; i++) {
+                        if (mags[i] == NULL)
+                                continue;
+                        if (mags[i]->count > 0)
+                                depot_push(&depots[cls].full, mags[i]);
+                        else
+                                depot_push(&depots[cls].empty, mags[i]);
+                }
+        }
+}
+
+void Pool_trim(void)
+{
+        Magazine_T mag;
+        int cls;
+
+        for (cls = 0; cls < NCLASSES; cls++) {
+                while ((mag = depot_pop(&depots[cls].full)) != NULL) {
+                        while (mag->count > 0)
+                                free(mag->objs[--mag->count]);
+                        depot_push(&depots[cls].empty, mag);
+                }
+        }
+}
+
+/*-------------------------------------
+ * Helper/Private Definitions
+ -------------------------------------*/
+static Magazine_T magazine_get(int cls)
+{
+        Magazine_T mag;
+        uint32_t index;
+
+        assert(cls >= 0 && cls < NCLASSES);
+
+        mag = depot_pop(&depots[cls].empty);
+        if (mag != NULL)
+                return mag;
+
+        /* stop counting at MAX_MAGS so the index can never wrap */
+        index = __atomic_load_n(&nmagazines, __ATOMIC_RELAXED);
+        do {
+                if (index >= MAX_MAGS)
+                        return NULL;
+        } while (!__atomic_compare_exchange_n(&nmagazines, &index, index + 1,
+                                              true, __ATOMIC_RELAXED,
+                                              __ATOMIC_RELAXED));
+
+        mag = malloc(sizeof(struct magazine_t));
+        assert(mag != NULL);
+
+        mag->next = 0;
+        mag->index = index;
+        mag->count = 0;
+        __atomic_store_n(&magazines[index], mag, __ATOMIC_RELEASE);
+
+        return mag;
+}
+
+static void depot_push(uint64_t *head, Magazine_T mag)
+{
+        uint64_t old;
+        uint64_t new;
+
+        assert(head != NULL);
+        assert(mag != NULL);
+
+        old = __atomic_load_n(head, __ATOMIC_ACQUIRE);
+        do {
+                __atomic_store_n(&mag->next, (uint32_t) old,
+                                 __ATOMIC_RELAXED);
+                new = (((old >> 32) + 1) << 32) | (mag->index + 1);
+        } while (!__atomic_compare_exchange_n(head, &old, new, true,
+                                              __ATOMIC_ACQ_REL,
+                                              __ATOMIC_ACQUIRE));
+}
+
+static Magazine_T depot_pop(uint64_t *head)
+{
+        Magazine_T mag;
+        uint64_t old;
+        uint64_t new;
+        uint32_t index;
+
+        assert(head != NULL);
+
+        old = __atomic_load_n(head, __ATOMIC_ACQUIRE);
+        do {
+                index = (uint32_t) old;
+                if (index == 0)
+                        return NULL;
+
+                mag = __atomic_load_n(&magazines[index - 1],
+                                      __ATOMIC_ACQUIRE);
+                new = (((old >> 32) + 1) << 32) |
+                      __atomic_load_n(&mag->next, __ATOMIC_RELAXED);
+        } while (!__atomic_compare_exchange_n(head, &old, new, true,
+                                              __ATOMIC_ACQ_REL,
+                                              __ATOMIC_ACQUIRE));
+
+        return mag;
+}
+
+static void cache_register(void)
+{
+        if (cache_registered)
+                return;
+
+        pthread_once(&cache_key_once, cache_key_init);
+        pthread_setspecific(cache_key, &cache_registered); //any non-NULL
+        cache_registered = true;
+}
+
+static void cache_key_init(void)
+{
+        pthread_key_create(&cache_key, cache_exit);
+}
+
+static void cache_exit(void *arg)
+{
+        (void) arg;
+
+        Pool_flush();
+        cache_registered = false; //later destructors may use the Pool
+}
+
+static inline int size_class(size_t size)
+{
+        if (size == 0)
+                return 0;
+
+        return (int) ((size - 1) / CLASS_SIZE);
+}
@@ -0,0 +1,716 @@
+/*
+ *      filename:       serial.c
+ *      author:         @keiferchiang
+ *      date:           18 Oct 2026
+ *      version:        0.0.1
+ *
+ *      description:    Implementation of the Serial module
+ *
+ *      note:           Elements are encoded straight into a frame
+ *                      buffer, which is written with a single fwrite
+ *                      once full. Compressed frames use an LZ4-style
+ *                      sequence format:
+ *
+ *                      token       u8, literal count << 4 | match - 4
+ *                      [ext]       255-runs extending a nibble of 15
+ *                      literals
+ *                      offset      u16 distance back to the match
+ *                      [ext]       extends the match length nibble
+ *
+ *                      The last sequence carries literals only.
+ */
+
+#include <stdint.h>
+#include <errno.h>
+#include <unistd.h>
+
+#include "serial.h"
+
+/*-------------------------------------
+ * Constants
+ -------------------------------------*/
+#define MAGIC           "CDS1"
+#define VERSION         1
+#define FLAG_COMPRESS   0x01
+#define HEADER_SIZE     8
+#define FRAME_HEADER    12
+#define FRAME_SIZE      (64 * 1024)
+#define MAX_FRAME       (1 << 30)
+#define MAX_VARINT      5
+
+#define HASH_BITS       12
+#define MIN_MATCH       4
+#define MAX_OFFSET      65535
+#define LAST_LITERALS   5
+
+/*-------------------------------------
+ * Representation
+ -------------------------------------*/
+struct serial_writer_t {
+        FILE *fp;
+        Serial_Codec_T codec;
+        unsigned char *buf;
+        int size;
+        int cap;
+        unsigned char *zbuf;
+        int zcap;
+        uint32_t count;
+        bool failed;
+};
+
+struct serial_reader_t {
+        FILE *fp;
+        Serial_Codec_T codec;
+        unsigned char *buf;
+        int len;
+        int pos;
+        int cap;
+        unsigned char *zbuf;
+        int zcap;
+        uint32_t remaining;
+        bool done;
+        bool failed;
+};
+
+/*-------------------------------------
+ * Globals
+ -------------------------------------*/
+char Serial_bad_record;
+
+/*-------------------------------------
+ * Helper/Private Prototypes
+ -------------------------------------*/
+/*
+ * Writes the current frame out and empties it
+ */
+static void flush_frame(Serial_Writer_T writer);
+
+/*
+ * Reads the next frame into the reader's buffer. Returns false at
+ * the end of the stream or on error
+ */
+static bool load_frame(Serial_Reader_T reader);
+
+/*
+ * Returns true if count varint-prefixed records exactly fill the
+ * len bytes of buf
+ */
+static bool check_frame(const unsigned char *buf, int len,
+                        uint32_t count);
+
+/*
+ * Grows *buf to hold at least size bytes
+ */
+static void reserve(unsigned char **buf, int *cap, int size);
+
+/*
+ * Little endian and varint codecs
+ */
+static inline void put_u32(unsigned char *buf, uint32_t n);
+static inline uint32_t get_u32(const unsigned char *buf);
+static inline int put_varint(unsigned char *buf, uint32_t n);
+static inline int get_varint(const unsigned char *buf, int len,
+                             uint32_t *n);
+
+/*
+ * Compresses n bytes of src into dst. Returns the compressed size,
+ * or -1 if it would not fit in cap bytes
+ */
+static int lz_compress(const unsigned char *src, int n,
+                       unsigned char *dst, int cap);
+
+/*
+ * Decompresses n bytes of src into exactly raw bytes of dst.
+ * Returns false on malformed input
+ */
+static bool lz_decompress(const unsigned char *src, int n,
+                          unsigned char *dst, int raw);
+
+/*-------------------------------------
+ * Function Definitions
+ -------------------------------------*/
+//////////////////////////////////
+//      Writer Functions        //
+//////////////////////////////////
+Serial_Writer_T Serial_writer_new(FILE *fp, const Serial_Codec_T *codec)
+{
+        Serial_Writer_T writer;
+        unsigned char header[HEADER_SIZE] = { 0 };
+
+        assert(fp != NULL);
+        assert(codec != NULL);
+        assert(codec->encode != NULL);
+
+        writer = malloc(sizeof(struct serial_writer_t));
+        assert(writer != NULL);
+
+        writer->fp = fp;
+        writer->codec = *codec;
+        writer->buf = NULL;
+        writer->cap = 0;
+        writer->size = 0;
+        writer->zbuf = NULL;
+        writer->zcap = 0;
+        writer->count = 0;
+        writer->failed = false;
+        reserve(&writer->buf, &writer->cap, FRAME_SIZE);
+
+        memcpy(header, MAGIC, 4);
+        header[4] = VERSION;
+        header[5] = codec->compress ? FLAG_COMPRESS : 0;
+        if (fwrite(header, 1, HEADER_SIZE, fp) != HEADER_SIZE)
+                writer->failed = true;
+
+        return writer;
+}
+
+bool Serial_write(Serial_Writer_T writer, void *elem)
+{
+        Serial_Codec_T *codec;
+        unsigned char *dst;
+        int need;
+        int vlen;
+
+        assert(writer != NULL);
+
+        if (writer->failed)
+                return false;
+
+        codec = &writer->codec;
+
+        /* encode past room for the length, then slide it down */
+        dst = writer->buf + writer->size + MAX_VARINT;
+        need = codec->encode(elem, dst, writer->cap - writer->size -
+                             MAX_VARINT, codec->cl);
+        if (need < 0) {
+                writer->failed = true;
+                return false;
+        }
+
+        if (need > writer->cap - writer->size - MAX_VARINT) {
+                if (writer->count > 0)
+                        flush_frame(writer);
+                if (need > writer->cap - MAX_VARINT)
+                        reserve(&writer->buf, &writer->cap,
+                                need + MAX_VARINT);
+
+                dst = writer->buf + MAX_VARINT;
+                if (codec->encode(elem, dst, writer->cap - MAX_VARINT,
+                                  codec->cl) != need) {
+                        writer->failed = true;
+                        return false;
+                }
+        }
+
+        vlen = put_varint(writer->buf + writer->size, (uint32_t) need);
+        if (vlen != MAX_VARINT)
+                memmove(writer->buf + writer->size + vlen, dst, need);
+
+        writer->size += vlen + need;
+        writer->count++;
+
+        if (writer->size >= writer->cap - MAX_VARINT)
+                flush_frame(writer);
+
+        return !writer->failed;
+}
+
+bool Serial_writer_free(Serial_Writer_T *writer)
+{
+        unsigned char end[FRAME_HEADER] = { 0 };
+        bool ok;
+
+        assert(writer != NULL);
+        assert(*writer != NULL);
+
+        if ((*writer)->count > 0)
+                flush_frame(*writer);
+
+        if (!(*writer)->failed &&
+            fwrite(end, 1, FRAME_HEADER, (*writer)->fp) != FRAME_HEADER)
+                (*writer)->failed = true;
+        if (fflush((*writer)->fp) != 0)
+                (*writer)->failed = true;
+
+        ok = !(*writer)->failed;
+
+        free((*writer)->buf);
+        free((*writer)->zbuf);
+        free(*writer);
+        *writer = NULL;
+
+        return ok;
+}
+
+//////////////////////////////////
+//      Reader Functions        //
+//////////////////////////////////
+Serial_Reader_T Serial_reader_new(FILE *fp, const Serial_Codec_T *codec)
+{
+        Serial_Reader_T reader;
+        unsigned char header[HEADER_SIZE];
+
+        assert(fp != NULL);
+        assert(codec != NULL);
+        assert(codec->decode != NULL);
+
+        if (fread(header, 1, HEADER_SIZE, fp) != HEADER_SIZE ||
+            memcmp(header, MAGIC, 4) != 0 || header[4] != VERSION)
+                return NULL;
+
+        reader = malloc(sizeof(struct serial_reader_t));
+        assert(reader != NULL);
+
+        reader->fp = fp;
+        reader->codec = *codec;
+        reader->buf = NULL;
+        reader->len = 0;
+        reader->pos = 0;
+        reader->cap = 0;
+        reader->zbuf = NULL;
+        reader->zcap = 0;
+        reader->remaining = 0;
+        reader->done = false;
+        reader->failed = false;
+
+        return reader;
+}
+
+bool Serial_read(Serial_Reader_T reader, void **elem)
+{
+        uint32_t length;
+        int vlen;
+
+        assert(reader != NULL);
+        assert(elem != NULL);
+
+        if (reader->remaining == 0 && !load_frame(reader))
+                return false;
+
+        vlen = get_varint(reader->buf + reader->pos,
+                          reader->len - reader->pos, &length);
+        if (vlen == 0 || length > (uint32_t) (reader->len - reader->pos -
+                                              vlen)) {
+                reader->failed = true;
+                reader->done = true;
+                return false;
+        }
+
+        reader->pos += vlen;
+        *elem = reader->codec.decode(reader->buf + reader->pos,
+                                     (int) length, reader->codec.cl);
+        if (*elem == SERIAL_BAD_RECORD) {
+                reader->failed = true;
+                reader->done = true;
+                return false;
+        }
+        reader->pos += length;
+        reader->remaining--;
+
+        return true;
+}
+
+bool Serial_reader_failed(Serial_Reader_T reader)
+{
+        assert(reader != NULL);
+
+        return reader->failed;
+}
+
+void Serial_reader_free(Serial_Reader_T *reader)
+{
+        assert(reader != NULL);
+        assert(*reader != NULL);
+
+        free((*reader)->buf);
+        free((*reader)->zbuf);
+        free(*reader);
+        *reader = NULL;
+}
+
+ssize_t Serial_writev(int fd, struct iovec *iov, int iovcnt)
+{
+        ssize_t total = 0;
+        ssize_t n;
+
+        assert(iov != NULL || iovcnt == 0);
+        assert(iovcnt >= 0 && iovcnt <= SERIAL_IOV_MAX);
+
+        while (iovcnt > 0) {
+                n = writev(fd, iov, iovcnt);
+                if (n < 0) {
+                        if (errno == EINTR)
+                                continue;
+                        return -1;
+                }
+                total += n;
+
+                //skip the buffers written in full, trim the next one
+                while (iovcnt > 0 && (size_t) n >= iov->iov_len) {
+                        n -= iov->iov_len;
+                        iov++;
+                        iovcnt--;
+                }
+                if (iovcnt > 0) {
+                        iov->iov_base = (char *) iov->iov_base + n;
+                        iov->iov_len -= n;
+                }
+        }
+
+        return total;
+}
+
+/*-------------------------------------
+ * Helper/Private Definitions
+ -------------------------------------*/
+static void flush_frame(Serial_Writer_T writer)
+{
+        unsigned char header[FRAME_HEADER];
+        unsigned char *payload;
+        int stored;
+
+        assert(writer != NULL);
+
+        payload = writer->buf;
+        stored = writer->size;
+
+        if (writer->codec.compress && writer->size > 0) {
+                reserve(&writer->zbuf, &writer->zcap, writer->size);
+                stored = lz_compress(writer->buf, writer->size,
+                                     writer->zbuf, writer->size - 1);
+                if (stored > 0)
+                        payload = writer->zbuf;
+                else
+                        stored = writer->size;
+        }
+
+        put_u32(header, writer->count);
+        put_u32(header + 4, (uint32_t) writer->size);
+        put_u32(header + 8, (uint32_t) stored);
+
+        if (!writer->failed &&
+            (fwrite(header, 1, FRAME_HEADER, writer->fp) != FRAME_HEADER ||
+             fwrite(payload, 1, stored, writer->fp) != (size_t) stored))
+                writer->failed = true;
+
+        writer->size = 0;
+        writer->count = 0;
+}
+
+static bool load_frame(Serial_Reader_T reader)
+{
+        unsigned char header[FRAME_HEADER];
+        uint32_t count, raw, stored;
+
+        assert(reader != NULL);
+
+        if (reader->done)
+                return false;
+
+        reader->done = true;
+
+        if (fread(header, 1, FRAME_HEADER, reader->fp) != FRAME_HEADER) {
+                reader->failed = true;
+                return false;
+        }
+
+        count = get_u32(header);
+        raw = get_u32(header + 4);
+        stored = get_u32(header + 8);
+
+        if (count == 0) {
+                reader->failed = (raw != 0 || stored != 0);
+                return false;
+        }
+
+        if (raw > MAX_FRAME || stored > raw || raw == 0) {
+                reader->failed = true;
+                return false;
+        }
+
+        reserve(&reader->buf, &reader->cap, (int) raw);
+
+        if (stored == raw) {
+                if (fread(reader->buf, 1, raw, reader->fp) != raw) {
+                        reader->failed = true;
+                        return false;
+                }
+        } else {
+                reserve(&reader->zbuf, &reader->zcap, (int) stored);
+                if (fread(reader->zbuf, 1, stored, reader->fp) != stored ||
+                    !lz_decompress(reader->zbuf, (int) stored,
+                                   reader->buf, (int) raw)) {
+                        reader->failed = true;
+                        return false;
+                }
+        }
+
+        if (!check_frame(reader->buf, (int) raw, count)) {
+                reader->failed = true;
+                return false;
+        }
+
+        reader->len = (int) raw;
+        reader->pos = 0;
+        reader->remaining = count;
+        reader->done = false;
+
+        return true;
+}
+
+static bool check_frame(const unsigned char *buf, int len,
+                        uint32_t count)
+{
+        uint32_t length;
+        int pos = 0;
+        int vlen;
+
+        for (; count > 0; count--) {
+                vlen = get_varint(buf + pos, len - pos, &length);
+                if (vlen == 0 || length > (uint32_t) (len - pos - vlen))
+                        return false;
+                pos += vlen + (int) length;
+        }
+
+        return pos == len;
+}
+
+static void reserve(unsigned char **buf, int *cap, int size)
+{
+        unsigned char *grown;
+
+        assert(buf != NULL);
+        assert(cap != NULL);
+
+        if (size <= *cap)
+                return;
+
+        grown = realloc(*buf, size);
+        assert(grown != NULL);
+
+        *buf = grown;
+        *cap = size;
+}
+
+static inline void put_u32(unsigned char *buf, uint32_t n)
+{
+        buf[0] = (unsigned char) n;
+        buf[1] = (unsigned char) (n >> 8);
+        buf[2] = (unsigned char) (n >> 16);
+        buf[3] = (unsigned char) (n >> 24);
+}
+
+static inline uint32_t get_u32(const unsigned char *buf)
+{
+        return (uint32_t) buf[0] | (uint32_t) buf[1] << 8 |
+               (uint32_t) buf[2] << 16 | (uint32_t) buf[3] << 24;
+}
+
+static inline int put_varint(unsigned char *buf, uint32_t n)
+{
+        int i = 0;
+
+        while (n >= 0x80) {
+                buf[i++] = (unsigned char) (n | 0x80);
+                n >>= 7;
+        }
+        buf[i++] = (unsigned char) n;
+
+        return i;
+}
+
+/*
+ * Returns the number of bytes consumed, or 0 if buf does not start
+ * with a valid varint
+ */
+static inline int get_varint(const unsigned char *buf, int len,
+                             uint32_t *n)
+{
+        uint32_t value = 0;
+        int i;
+
+        for (i = 0; i < len && i < MAX_VARINT; i++) {
+                value |= (uint32_t) (buf[i] & 0x7f) << (7 * i);
+                if ((buf[i] & 0x80) == 0) {
+                        *n = value;
+                        return i + 1;
+                }
+        }
+
+        return 0;
+}
+
+//////////////////////////////////
+//      Compression             //
+//////////////////////////////////
+static inline uint32_t read32(const unsigned char *p)
+{
+        uint32_t v;
+
+        memcpy(&v, p, sizeof(v));
+
+        return v;
+}
+
+static inline uint32_t hash32(uint32_t v)
+{
+        return (v * 2654435761u) >> (32 - HASH_BITS);
+}
+
+/*
+ * Writes a length nibble overflow as 255-runs. Returns the new
+ * output position
+ */
+static inline int put_length(unsigned char *dst, int op, int len)
+{
+        while (len >= 255) {
+                dst[op++] = 255;
+                len -= 255;
+        }
+        dst[op++] = (unsigned char) len;
+
+        return op;
+}
+
+/*
+ * Emits one sequence. match is 0 for the final, literal-only
+ * sequence. Returns the new output position, or -1 if the
+ * sequence does not fit
+ */
+static int put_sequence(unsigned char *dst, int op, int cap,
+                        const unsigned char *lit, int nlit,
+                        int offset, int match)
+{
+        unsigned char *token;
+        int mlen = match - MIN_MATCH;
+
+        if (op + 1 + nlit + nlit / 255 + 1 + 2 + mlen / 255 + 1 > cap)
+                return -1;
+
+        token = &dst[op++];
+        *token = (unsigned char) ((nlit < 15 ? nlit : 15) << 4);
+        if (nlit >= 15)
+                op = put_length(dst, op, nlit - 15);
+
+        memcpy(dst + op, lit, nlit);
+        op += nlit;
+
+        if (match == 0)
+                return op;
+
+        dst[op++] = (unsigned char) offset;
+        dst[op++] = (unsigned char) (offset >> 8);
+
+        *token |= (unsigned char) (mlen < 15 ? mlen : 15);
+        if (mlen >= 15)
+                op = put_length(dst, op, mlen - 15);
+
+        return op;
+}
+
+static int lz_compress(const unsigned char *src, int n,
+                       unsigned char *dst, int cap)
+{
+        int table[1 << HASH_BITS];
+        int anchor = 0;
+        int ip = 0;
+        int op = 0;
+        int limit = n - LAST_LITERALS - MIN_MATCH;
+        int misses = 0;
+        int ref, len;
+        uint32_t h;
+
+        memset(table, 0xff, sizeof(table));
+
+        while (ip < limit) {
+                h = hash32(read32(src + ip));
+                ref = table[h];
+                table[h] = ip;
+
+                if (ref < 0 || ip - ref > MAX_OFFSET ||
+                    read32(src + ref) != read32(src + ip)) {
+                        /* skip faster through incompressible data */
+                        ip += 1 + (misses++ >> 5);
+                        continue;
+                }
+
+                len = MIN_MATCH;
+                while (ip + len < n - LAST_LITERALS &&
+                       src[ref + len] == src[ip + len])
+                        len++;
+
+                op = put_sequence(dst, op, cap, src + anchor, ip - anchor,
+                                  ip - ref, len);
+                if (op < 0)
+                        return -1;
+
+                ip += len;
+                anchor = ip;
+                misses = 0;
+        }
+
+        return put_sequence(dst, op, cap, src + anchor, n - anchor, 0, 0);
+}
+
+/*
+ * Reads a 255-run length extension. Returns false on overrun
+ */
+static inline bool get_length(const unsigned char *src, int n, int *ip,
+                              int *len)
+{
+        unsigned char byte;
+
+        do {
+                if (*ip >= n || *len > MAX_FRAME)
+                        return false;
+                byte = src[(*ip)++];
+                *len += byte;
+        } while (byte == 255);
+
+        return true;
+}
+
+static bool lz_decompress(const unsigned char *src, int n,
+                          unsigned char *dst, int raw)
+{
+        int ip = 0;
+        int op = 0;
+        int nlit, match, offset;
+        unsigned char token;
+
+        while (ip < n) {
+                token = src[ip++];
+
+                nlit = token >> 4;
+                if (nlit == 15 && !get_length(src, n, &ip, &nlit))
+                        return false;
+                if (nlit > n - ip || nlit > raw - op)
+                        return false;
+
+                memcpy(dst + op, src + ip, nlit);
+                ip += nlit;
+                op += nlit;
+
+                if (ip == n)
+                        break;
+
+                if (n - ip < 2)
+                        return false;
+                offset = src[ip] | src[ip + 1] << 8;
+                ip += 2;
+
+                match = token & 15;
+                if (match == 15 && !get_length(src, n, &ip, &match))
+                        return false;
+                match += MIN_MATCH;
+
+                if (offset == 0 || offset > op || match > raw - op)
+                        return false;
+
+                /* byte-wise, since the match may overlap itself */
+                for (; match > 0; match--, op++)
+                        dst[op] = dst[op - offset];
+        }
+
+        return op == raw;
+}
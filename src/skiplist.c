@@ -0,0 +1,629 @@
+/*
+ *      filename:       skiplist.c
+ *      author:         @keiferchiang
+ *      date:           18 Oct 2026
+ *      version:        0.0.1
+ *
+ *      description:    Implementation of the SkipList module
+ *
+ *      note:           Fraser's lock-free skip list. The low bit of a
+ *                      node's next pointer at a level marks the node
+ *                      as deleted at that level, which also freezes
+ *                      the pointer: every CAS expects an unmarked
+ *                      value, so nothing can be linked after a marked
+ *                      node. Removal marks the levels top down and the
+ *                      CAS that marks level 0 decides which remover
+ *                      wins. Searches made by updates unlink every
+ *                      marked node they pass; lookups and scans just
+ *                      step over them.
+ *
+ *                      A node is retired once both its inserter has
+ *                      stopped linking it and its remover has unlinked
+ *                      it; refs counts the two down. Retired nodes
+ *                      wait on their thread's limbo list for the epoch
+ *                      they were retired in, and are freed once the
+ *                      global epoch is two ahead of it. The epoch only
+ *                      advances when every thread inside an operation
+ *                      has seen the current one, so by then none can
+ *                      still hold a pointer to the node. Threads try
+ *                      to advance it every RETIRE_BATCH retirements
+ *                      and again when they call SkipList_thread_free.
+ */
+
+#include <stdint.h>
+
+#include "skiplist.h"
+
+/*-------------------------------------
+ * Constants
+ -------------------------------------*/
+#define MAX_LEVEL       16      //4^16 keys at one level in four
+#define EPOCHS          3
+#define RETIRE_BATCH    64      //retirements between advance attempts
+#define RECORD_PAD      64
+
+/*-------------------------------------
+ * Representation
+ -------------------------------------*/
+typedef struct skip_node_t {
+        void *key;
+        void *value;
+        struct skip_node_t *limbo;
+        int height;
+        int refs;
+        uintptr_t next[]; //successor per level, low bit marks deletion
+} Skip_Node_T;
+
+typedef struct ebr_record_t {
+        struct ebr_record_t *next;
+        uint64_t epoch;
+        int active;
+        int claimed;
+        int depth;
+        int retired;
+        uint64_t seen;
+        Skip_Node_T *limbo[EPOCHS];
+        char pad[RECORD_PAD]; //keeps other threads' records apart
+} Ebr_Record_T;
+
+struct skiplist_t {
+        Skip_Node_T *head;
+        int levels;
+        int length;
+        int (*cmp)(void *a, void *b, void *cl);
+        void *cl;
+};
+
+/*-------------------------------------
+ * Globals
+ -------------------------------------*/
+static Ebr_Record_T *ebr_records = NULL;
+static uint64_t ebr_epoch = 0;
+static __thread Ebr_Record_T *ebr_self = NULL;
+static __thread uint32_t skip_seed = 0;
+
+/*-------------------------------------
+ * Helper/Private Prototypes
+ -------------------------------------*/
+/*
+ * Marked pointer helpers
+ */
+static inline Skip_Node_T *skip_ptr(uintptr_t link);
+static inline bool skip_marked(uintptr_t link);
+static inline uintptr_t skip_load(uintptr_t *link);
+static inline bool skip_cas(uintptr_t *link, uintptr_t expected,
+                            uintptr_t desired);
+
+/*
+ * Allocates a node with height levels
+ */
+static Skip_Node_T *skip_node_new(void *key, void *value, int height);
+
+/*
+ * Returns a random height, each level one in four as likely as the
+ * one below
+ */
+static int skip_height(void);
+
+/*
+ * Fills preds and succs, when not NULL, with the nodes either side
+ * of key at each level, unlinking marked nodes on the way. Returns
+ * true if succs[0] holds key
+ */
+static bool skip_find(SkipList_T list, void *key, Skip_Node_T **preds,
+                      Skip_Node_T **succs);
+
+/*
+ * Returns the first live node at level 0 not before key, without
+ * writing to the list
+ */
+static Skip_Node_T *skip_seek(SkipList_T list, void *key);
+
+/*
+ * Drops one of a node's two references, retiring it on the last
+ */
+static void skip_release(Ebr_Record_T *rec, Skip_Node_T *node);
+
+/*
+ * Starts and ends an operation on the calling thread. Operations
+ * nest
+ */
+static Ebr_Record_T *ebr_enter(void);
+static void ebr_exit(Ebr_Record_T *rec);
+
+/*
+ * Frees the limbo list that is safe to free once the global epoch
+ * has reached epoch
+ */
+static void ebr_reclaim(Ebr_Record_T *rec, uint64_t epoch);
+
+/*
+ * Returns a free record for the calling thread, reusing a released
+ * one when there is one
+ */
+static Ebr_Record_T *ebr_claim(void);
+
+/*
+ * Queues an unlinked node to be freed two epochs from now
+ */
+static void ebr_retire(Ebr_Record_T *rec, Skip_Node_T *node);
+
+/*
+ * Advances the global epoch if every active thread has seen it
+ */
+static void ebr_advance(void);
+
+/*-------------------------------------
+ * Function Definitions
+ -------------------------------------*/
+SkipList_T SkipList_new(int cmp(void *a, void *b, void *cl), void *cl)
+{
+        SkipList_T list;
+
+        assert(cmp != NULL);
+
+        list = malloc(sizeof(struct skiplist_t));
+        assert(list != NULL);
+
+        list->head = skip_node_new(NULL, NULL, MAX_LEVEL);
+        list->levels = 1;
+        list->length = 0;
+        list->cmp = cmp;
+        list->cl = cl;
+
+        return list;
+}
+
+void SkipList_free(SkipList_T *list)
+{
+        Skip_Node_T *node, *next;
+
+        assert(list != NULL);
+        assert(*list != NULL);
+
+        for (node = (*list)->head; node != NULL; node = next) {
+                next = skip_ptr(node->next[0]);
+                free(node);
+        }
+        free(*list);
+        *list = NULL;
+}
+
+bool SkipList_insert(SkipList_T list, void *key, void *value)
+{
+        Skip_Node_T *preds[MAX_LEVEL], *succs[MAX_LEVEL];
+        Skip_Node_T *node = NULL;
+        Ebr_Record_T *rec;
+        uintptr_t link;
+        int height, levels;
+        int i;
+
+        assert(list != NULL);
+
+        height = skip_height();
+        levels = __atomic_load_n(&list->levels, __ATOMIC_RELAXED);
+        while (levels < height &&
+               !__atomic_compare_exchange_n(&list->levels, &levels, height,
+                                            false, __ATOMIC_SEQ_CST,
+                                            __ATOMIC_RELAXED))
+                ;
+
+        rec = ebr_enter();
+        for (;;) {
+                if (skip_find(list, key, preds, succs)) {
+                        ebr_exit(rec);
+                        free(node);
+                        return false;
+                }
+                if (node == NULL)
+                        node = skip_node_new(key, value, height);
+                for (i = 0; i < height; i++)
+                        node->next[i] = (uintptr_t) succs[i];
+                if (skip_cas(&preds[0]->next[0], (uintptr_t) succs[0],
+                             (uintptr_t) node))
+                        break;
+        }
+        __atomic_add_fetch(&list->length, 1, __ATOMIC_RELAXED);
+
+        for (i = 1; i < height; i++) {
+                for (;;) {
+                        if (succs[i] != NULL &&
+                            list->cmp(succs[i]->key, key, list->cl) == 0) {
+                                /*
+                                 * A dying node with our key: linked in
+                                 * front of it, we would hide it from its
+                                 * remover's search, so let it go first
+                                 */
+                                skip_find(list, key, preds, succs);
+                                if (succs[0] != node)
+                                        goto done;
+                                continue;
+                        }
+                        link = skip_load(&node->next[i]);
+                        if (skip_marked(link))
+                                goto done;
+                        if (skip_ptr(link) != succs[i] &&
+                            !skip_cas(&node->next[i], link,
+                                      (uintptr_t) succs[i]))
+                                goto done; //marked under us
+                        if (skip_cas(&preds[i]->next[i],
+                                     (uintptr_t) succs[i], (uintptr_t) node))
+                                break;
+                        skip_find(list, key, preds, succs);
+                        if (succs[0] != node)
+                                goto done; //already removed
+                }
+        }
+
+done:
+        /* a remover may have finished while we were still linking */
+        if (skip_marked(skip_load(&node->next[0])))
+                skip_find(list, key, NULL, NULL);
+        skip_release(rec, node);
+        ebr_exit(rec);
+
+        return true;
+}
+
+bool SkipList_remove(SkipList_T list, void *key, void **value)
+{
+        Skip_Node_T *succs[MAX_LEVEL];
+        Skip_Node_T *node;
+        Ebr_Record_T *rec;
+        uintptr_t link;
+        int i;
+
+        assert(list != NULL);
+
+        rec = ebr_enter();
+        for (;;) {
+                if (!skip_find(list, key, NULL, succs)) {
+                        ebr_exit(rec);
+                        return false;
+                }
+                node = succs[0];
+
+                for (i = node->height - 1; i > 0; i--) {
+                        link = skip_load(&node->next[i]);
+                        while (!skip_marked(link) &&
+                               !skip_cas(&node->next[i], link, link | 1))
+                                link = skip_load(&node->next[i]);
+                }
+
+                link = skip_load(&node->next[0]);
+                while (!skip_marked(link) &&
+                       !skip_cas(&node->next[0], link, link | 1))
+                        link = skip_load(&node->next[0]);
+                if (!skip_marked(link))
+                        break; //our CAS marked it
+                /* another remover won: look again in case of a re-insert */
+        }
+
+        if (value != NULL)
+                *value = node->value;
+        __atomic_sub_fetch(&list->length, 1, __ATOMIC_RELAXED);
+
+        skip_find(list, key, NULL, NULL);
+        skip_release(rec, node);
+        ebr_exit(rec);
+
+        return true;
+}
+
+bool SkipList_get(SkipList_T list, void *key, void **value)
+{
+        Skip_Node_T *node;
+        Ebr_Record_T *rec;
+        bool found;
+
+        assert(list != NULL);
+
+        rec = ebr_enter();
+        node = skip_seek(list, key);
+        found = node != NULL && list->cmp(node->key, key, list->cl) == 0;
+        if (found && value != NULL)
+                *value = node->value;
+        ebr_exit(rec);
+
+        return found;
+}
+
+int SkipList_range(SkipList_T list, void *lo, void *hi,
+                   bool visit(void *key, void *value, void *cl), void *cl)
+{
+        Skip_Node_T *node, *next;
+        Ebr_Record_T *rec;
+        uintptr_t link;
+        int count = 0;
+
+        assert(list != NULL);
+        assert(visit != NULL);
+
+        rec = ebr_enter();
+        if (lo != NULL)
+                node = skip_seek(list, lo);
+        else
+                node = skip_ptr(skip_load(&list->head->next[0]));
+        for (; node != NULL; node = next) {
+                link = skip_load(&node->next[0]);
+                next = skip_ptr(link);
+                if (skip_marked(link))
+                        continue;
+                if (hi != NULL && list->cmp(node->key, hi, list->cl) >= 0)
+                        break;
+                count++;
+                if (!visit(node->key, node->value, cl))
+                        break;
+        }
+        ebr_exit(rec);
+
+        return count;
+}
+
+int SkipList_length(SkipList_T list)
+{
+        assert(list != NULL);
+
+        return __atomic_load_n(&list->length, __ATOMIC_RELAXED);
+}
+
+void SkipList_thread_free(void)
+{
+        Ebr_Record_T *rec = ebr_self;
+        int e;
+
+        if (rec == NULL)
+                return;
+
+        assert(rec->depth == 0);
+
+        /* with no other thread mid-operation, this empties every list */
+        for (e = 0; e < EPOCHS; e++) {
+                ebr_advance();
+                ebr_reclaim(rec, __atomic_load_n(&ebr_epoch,
+                                                 __ATOMIC_SEQ_CST));
+        }
+        rec->retired = 0;
+
+        ebr_self = NULL;
+        __atomic_store_n(&rec->claimed, 0, __ATOMIC_RELEASE);
+}
+
+/*-------------------------------------
+ * Helper/Private Definitions
+ -------------------------------------*/
+static inline Skip_Node_T *skip_ptr(uintptr_t link)
+{
+        return (Skip_Node_T *) (link & ~(uintptr_t) 1);
+}
+
+static inline bool skip_marked(uintptr_t link)
+{
+        return (link & 1) != 0;
+}
+
+static inline uintptr_t skip_load(uintptr_t *link)
+{
+        return __atomic_load_n(link, __ATOMIC_ACQUIRE);
+}
+
+static inline bool skip_cas(uintptr_t *link, uintptr_t expected,
+                            uintptr_t desired)
+{
+        return __atomic_compare_exchange_n(link, &expected, desired, false,
+                                           __ATOMIC_SEQ_CST,
+                                           __ATOMIC_ACQUIRE);
+}
+
+static Skip_Node_T *skip_node_new(void *key, void *value, int height)
+{
+        Skip_Node_T *node;
+
+        node = calloc(1, sizeof(Skip_Node_T) + height * sizeof(uintptr_t));
+        assert(node != NULL);
+
+        node->key = key;
+        node->value = value;
+        node->height = height;
+        node->refs = 2;
+
+        return node;
+}
+
+static int skip_height(void)
+{
+        uint32_t x = skip_seed;
+        int height = 1;
+
+        if (x == 0) //first use on this thread: seed from its TLS address
+                x = (uint32_t) ((uintptr_t) &skip_seed >> 4) * 2654435761u
+                    | 1;
+
+        /* xorshift32 */
+        x ^= x << 13;
+        x ^= x >> 17;
+        x ^= x << 5;
+        skip_seed = x;
+
+        while (height < MAX_LEVEL && (x & 3) == 0) {
+                height++;
+                x >>= 2;
+        }
+
+        return height;
+}
+
+static bool skip_find(SkipList_T list, void *key, Skip_Node_T **preds,
+                      Skip_Node_T **succs)
+{
+        Skip_Node_T *pred, *curr;
+        uintptr_t link;
+        int levels, level;
+        int c = 1;
+
+        levels = __atomic_load_n(&list->levels, __ATOMIC_ACQUIRE);
+
+retry:
+        pred = list->head;
+        curr = NULL;
+        for (level = MAX_LEVEL - 1; level >= 0; level--) {
+                if (level < levels)
+                        curr = skip_ptr(skip_load(&pred->next[level]));
+                while (level < levels && curr != NULL) {
+                        link = skip_load(&curr->next[level]);
+                        if (skip_marked(link)) {
+                                if (!skip_cas(&pred->next[level],
+                                              (uintptr_t) curr,
+                                              (link & ~(uintptr_t) 1)))
+                                        goto retry; //pred changed or died
+                                curr = skip_ptr(link);
+                                continue;
+                        }
+                        c = list->cmp(curr->key, key, list->cl);
+                        if (c >= 0)
+                                break;
+                        pred = curr;
+                        curr = skip_ptr(link);
+                }
+                if (preds != NULL)
+                        preds[level] = pred;
+                if (succs != NULL)
+                        succs[level] = curr;
+        }
+
+        return curr != NULL && c == 0;
+}
+
+static Skip_Node_T *skip_seek(SkipList_T list, void *key)
+{
+        Skip_Node_T *pred = list->head;
+        Skip_Node_T *curr = NULL;
+        uintptr_t link;
+        int level;
+
+        level = __atomic_load_n(&list->levels, __ATOMIC_ACQUIRE) - 1;
+        for (; level >= 0; level--) {
+                curr = skip_ptr(skip_load(&pred->next[level]));
+                while (curr != NULL) {
+                        link = skip_load(&curr->next[level]);
+                        if (!skip_marked(link)) {
+                                if (list->cmp(curr->key, key, list->cl) >= 0)
+                                        break;
+                                pred = curr;
+                        }
+                        curr = skip_ptr(link);
+                }
+        }
+
+        return curr;
+}
+
+static void skip_release(Ebr_Record_T *rec, Skip_Node_T *node)
+{
+        if (__atomic_sub_fetch(&node->refs, 1, __ATOMIC_ACQ_REL) == 0)
+                ebr_retire(rec, node);
+}
+
+static Ebr_Record_T *ebr_enter(void)
+{
+        Ebr_Record_T *rec = ebr_self;
+        uint64_t epoch;
+
+        if (rec == NULL)
+                rec = ebr_self = ebr_claim();
+        if (rec->depth++ > 0)
+                return rec;
+
+        __atomic_store_n(&rec->active, 1, __ATOMIC_SEQ_CST);
+        epoch = __atomic_load_n(&ebr_epoch, __ATOMIC_SEQ_CST);
+        __atomic_store_n(&rec->epoch, epoch, __ATOMIC_SEQ_CST);
+
+        if (epoch != rec->seen)
+                ebr_reclaim(rec, epoch);
+
+        return rec;
+}
+
+static void ebr_reclaim(Ebr_Record_T *rec, uint64_t epoch)
+{
+        Skip_Node_T *node, *next;
+        int e;
+
+        /*
+         * Every node here was retired at or before epoch, in an epoch
+         * congruent to epoch + 1, so two or more epochs ago
+         */
+        e = (int) ((epoch + 1) % EPOCHS);
+        for (node = rec->limbo[e]; node != NULL; node = next) {
+                next = node->limbo;
+                free(node);
+        }
+        rec->limbo[e] = NULL;
+        rec->seen = epoch;
+}
+
+static void ebr_exit(Ebr_Record_T *rec)
+{
+        if (--rec->depth == 0)
+                __atomic_store_n(&rec->active, 0, __ATOMIC_RELEASE);
+}
+
+static Ebr_Record_T *ebr_claim(void)
+{
+        Ebr_Record_T *rec;
+        int unclaimed;
+
+        rec = __atomic_load_n(&ebr_records, __ATOMIC_ACQUIRE);
+        for (; rec != NULL; rec = rec->next) {
+                unclaimed = 0;
+                if (__atomic_compare_exchange_n(&rec->claimed, &unclaimed, 1,
+                                                false, __ATOMIC_ACQUIRE,
+                                                __ATOMIC_RELAXED))
+                        return rec;
+        }
+
+        rec = calloc(1, sizeof(Ebr_Record_T));
+        assert(rec != NULL);
+        rec->claimed = 1;
+
+        rec->next = __atomic_load_n(&ebr_records, __ATOMIC_RELAXED);
+        while (!__atomic_compare_exchange_n(&ebr_records, &rec->next, rec,
+                                            false, __ATOMIC_RELEASE,
+                                            __ATOMIC_RELAXED))
+                ;
+
+        return rec;
+}
+
+static void ebr_retire(Ebr_Record_T *rec, Skip_Node_T *node)
+{
+        uint64_t epoch;
+        int e;
+
+        epoch = __atomic_load_n(&ebr_epoch, __ATOMIC_SEQ_CST);
+        e = (int) (epoch % EPOCHS);
+        node->limbo = rec->limbo[e];
+        rec->limbo[e] = node;
+
+        if (++rec->retired == RETIRE_BATCH) {
+                rec->retired = 0;
+                ebr_advance();
+        }
+}
+
+static void ebr_advance(void)
+{
+        Ebr_Record_T *rec;
+        uint64_t epoch;
+
+        epoch = __atomic_load_n(&ebr_epoch, __ATOMIC_SEQ_CST);
+
+        rec = __atomic_load_n(&ebr_records, __ATOMIC_ACQUIRE);
+        for (; rec != NULL; rec = rec->next)
+                if (__atomic_load_n(&rec->active, __ATOMIC_SEQ_CST) &&
+                    __atomic_load_n(&rec->epoch, __ATOMIC_SEQ_CST) != epoch)
+                        return;
+
+        __atomic_compare_exchange_n(&ebr_epoch, &epoch, epoch + 1, false,
+                                    __ATOMIC_SEQ_CST, __ATOMIC_RELAXED);
+}
@@ -0,0 +1,230 @@
+/*
+ *      filename:       slotmap.c
+ *      author:         @keiferchiang
+ *      date:           18 Oct 2026
+ *      version:        0.0.1
+ *
+ *      description:    Implementation of the SlotMap module
+ *
+ *      note:           A handle is (generation << 32) | slot. A live
+ *                      slot holds the dense index of its element and
+ *                      the dense side records each element's slot, so
+ *                      removal can swap the last element into the
+ *                      hole and repoint that element's slot. A free
+ *                      slot holds the next free slot instead; freeing
+ *                      bumps its generation, which invalidates every
+ *                      handle issued for it. Generations start at 1
+ *                      and skip 0, so no handle is ever SLOTMAP_NIL.
+ *
+ *      design:         slots   [ gen | dense ] [ gen | next free ] ...
+ *                      values  [ elem ] [ elem ] ...   (Vector_T)
+ *                      owners  [ slot ] [ slot ] ...   (Vector_T)
+ */
+
+#include "slotmap.h"
+
+/*-------------------------------------
+ * Constants
+ -------------------------------------*/
+#define NO_SLOT         UINT32_MAX
+
+/*-------------------------------------
+ * Representation
+ -------------------------------------*/
+typedef struct slot_t {
+        uint32_t generation;
+        uint32_t index;
+} Slot_T;
+
+struct slotmap_t {
+        Vector_T values;
+        Vector_T owners;
+        Slot_T *slots;
+        uint32_t nslots;
+        uint32_t capacity;
+        uint32_t free_head;
+};
+
+/*-------------------------------------
+ * Helper/Private Prototypes
+ -------------------------------------*/
+/*
+ * Returns the slot named by handle if the handle is live, else NULL
+ */
+static inline Slot_T *slot_lookup(SlotMap_T map, uint64_t handle);
+
+/*-------------------------------------
+ * Function Definitions
+ -------------------------------------*/
+SlotMap_T SlotMap_new(int hint)
+{
+        SlotMap_T map;
+
+        assert(hint >= 0);
+        assert(hint < INT_MAX);
+
+        map = malloc(sizeof(struct slotmap_t));
+        assert(map != NULL);
+
+        map->values = Vector_new(hint);
+        map->owners = Vector_new(hint);
+        map->capacity = hint > 0 ? (uint32_t) hint : 8;
+        map->slots = malloc(map->capacity * sizeof(Slot_T));
+        assert(map->slots != NULL);
+        map->nslots = 0;
+        map->free_head = NO_SLOT;
+
+        return map;
+}
+
+void SlotMap_free(SlotMap_T *map)
+{
+        assert(map != NULL);
+        assert(*map != NULL);
+
+        Vector_free(&(*map)->values);
+        Vector_free(&(*map)->owners);
+        free((*map)->slots);
+        free(*map);
+        *map = NULL;
+}
+
+uint64_t SlotMap_insert(SlotMap_T map, void *elem)
+{
+        Slot_T *slots;
+        uint32_t s;
+
+        assert(map != NULL);
+
+        if (map->free_head != NO_SLOT) {
+                s = map->free_head;
+                map->free_head = map->slots[s].index;
+        } else {
+                assert(map->nslots < NO_SLOT - 1);
+
+                if (map->nslots == map->capacity) {
+                        map->capacity = map->capacity < NO_SLOT / 2 ?
+                                        2 * map->capacity : NO_SLOT;
+                        slots = realloc(map->slots,
+                                        map->capacity * sizeof(Slot_T));
+                        assert(slots != NULL);
+                        map->slots = slots;
+                }
+
+                s = map->nslots++;
+                map->slots[s].generation = 1;
+        }
+
+        map->slots[s].index = (uint32_t) Vector_length(map->values);
+        Vector_append(map->values, elem);
+        Vector_append(map->owners, Vector_int(s));
+
+        return ((uint64_t) map->slots[s].generation << 32) | s;
+}
+
+bool SlotMap_contains(SlotMap_T map, uint64_t handle)
+{
+        assert(map != NULL);
+
+        return slot_lookup(map, handle) != NULL;
+}
+
+void *SlotMap_get(SlotMap_T map, uint64_t handle)
+{
+        Slot_T *slot;
+
+        assert(map != NULL);
+
+        slot = slot_lookup(map, handle);
+        if (slot == NULL)
+                return NULL;
+
+        return Vector_data(map->values)[slot->index];
+}
+
+bool SlotMap_remove(SlotMap_T map, uint64_t handle, void **elem)
+{
+        Slot_T *slot;
+        uint32_t s = (uint32_t) handle;
+        uint32_t index;
+        uint32_t last;
+        intptr_t moved;
+
+        assert(map != NULL);
+
+        slot = slot_lookup(map, handle);
+        if (slot == NULL)
+                return false;
+
+        index = slot->index;
+        if (elem != NULL)
+                *elem = Vector_get(map->values, index);
+
+        /* the last element fills the hole and its slot follows it */
+        last = (uint32_t) Vector_length(map->values) - 1;
+        if (index != last) {
+                moved = Vector_toint(Vector_get(map->owners, last));
+                map->slots[moved].index = index;
+                Vector_set(map->owners, Vector_int(moved), index);
+        }
+        Vector_swap_remove(map->values, index);
+        Vector_removehi(map->owners);
+
+        slot->generation++;
+        if (slot->generation == 0)
+                slot->generation = 1;
+        slot->index = map->free_head;
+        map->free_head = s;
+
+        return true;
+}
+
+int SlotMap_length(SlotMap_T map)
+{
+        assert(map != NULL);
+
+        return Vector_length(map->values);
+}
+
+uint64_t SlotMap_handle(SlotMap_T map, int index)
+{
+        uint32_t s;
+
+        assert(map != NULL);
+
+        s = (uint32_t) Vector_toint(Vector_get(map->owners, index));
+
+        return ((uint64_t) map->slots[s].generation << 32) | s;
+}
+
+Vector_T SlotMap_values(SlotMap_T map)
+{
+        assert(map != NULL);
+
+        return map->values;
+}
+
+Iter_T SlotMap_iter(SlotMap_T map)
+{
+        assert(map != NULL);
+
+        return Vector_iter(map->values);
+}
+
+/*-------------------------------------
+ * Helper/Private Definitions
+ -------------------------------------*/
+static inline Slot_T *slot_lookup(SlotMap_T map, uint64_t handle)
+{
+        uint32_t s = (uint32_t) handle;
+        Slot_T *slot;
+
+        if (s >= map->nslots)
+                return NULL;
+
+        slot = &map->slots[s];
+        if (slot->generation != (uint32_t) (handle >> 32))
+                return NULL;
+
+        return slot;
+}
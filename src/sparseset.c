@@ -0,0 +1,167 @@
+/*
+ *      filename:       sparseset.c
+ *      author:         @keiferchiang
+ *      date:           18 Oct 2026
+ *      version:        0.0.1
+ *
+ *      description:    Implementation of the SparseSet module
+ *
+ *      note:           Briggs and Torczon's representation: dense
+ *                      holds the members and sparse[id] the position
+ *                      of id in dense. id is a member exactly when
+ *                      sparse[id] < length and dense[sparse[id]] == id,
+ *                      so entries left behind by removed or cleared
+ *                      members are harmless and clear only resets the
+ *                      length. sparse comes from calloc, which the
+ *                      allocator serves from untouched zero pages for
+ *                      large universes, so it is never read
+ *                      uninitialized and never needs a memset.
+ */
+
+#include "sparseset.h"
+
+/*-------------------------------------
+ * Representation
+ -------------------------------------*/
+struct sparseset_t {
+        Vector_T dense;
+        int *sparse;
+        int universe;
+};
+
+/*-------------------------------------
+ * Helper/Private Prototypes
+ -------------------------------------*/
+/*
+ * Returns the dense index of id, or -1 if id is not a member
+ */
+static inline int sparse_find(SparseSet_T set, int id);
+
+/*-------------------------------------
+ * Function Definitions
+ -------------------------------------*/
+SparseSet_T SparseSet_new(int universe)
+{
+        SparseSet_T set;
+
+        assert(universe >= 0);
+        assert(universe < INT_MAX);
+
+        set = malloc(sizeof(struct sparseset_t));
+        assert(set != NULL);
+
+        set->dense = Vector_new(0);
+        set->sparse = calloc(universe > 0 ? universe : 1, sizeof(int));
+        assert(set->sparse != NULL);
+        set->universe = universe;
+
+        return set;
+}
+
+void SparseSet_free(SparseSet_T *set)
+{
+        assert(set != NULL);
+        assert(*set != NULL);
+
+        Vector_free(&(*set)->dense);
+        free((*set)->sparse);
+        free(*set);
+        *set = NULL;
+}
+
+bool SparseSet_insert(SparseSet_T set, int id)
+{
+        assert(set != NULL);
+        assert(id >= 0 && id < set->universe);
+
+        if (sparse_find(set, id) >= 0)
+                return false;
+
+        set->sparse[id] = Vector_length(set->dense);
+        Vector_append(set->dense, Vector_int(id));
+
+        return true;
+}
+
+bool SparseSet_remove(SparseSet_T set, int id)
+{
+        int index;
+        int last;
+
+        assert(set != NULL);
+        assert(id >= 0 && id < set->universe);
+
+        index = sparse_find(set, id);
+        if (index < 0)
+                return false;
+
+        last = (int) Vector_toint(Vector_last(set->dense));
+        set->sparse[last] = index;
+        Vector_swap_remove(set->dense, index);
+
+        return true;
+}
+
+bool SparseSet_contains(SparseSet_T set, int id)
+{
+        assert(set != NULL);
+        assert(id >= 0 && id < set->universe);
+
+        return sparse_find(set, id) >= 0;
+}
+
+void SparseSet_clear(SparseSet_T set)
+{
+        assert(set != NULL);
+
+        Vector_resize(set->dense, 0);
+}
+
+int SparseSet_length(SparseSet_T set)
+{
+        assert(set != NULL);
+
+        return Vector_length(set->dense);
+}
+
+int SparseSet_universe(SparseSet_T set)
+{
+        assert(set != NULL);
+
+        return set->universe;
+}
+
+int SparseSet_get(SparseSet_T set, int index)
+{
+        assert(set != NULL);
+
+        return (int) Vector_toint(Vector_get(set->dense, index));
+}
+
+Vector_T SparseSet_values(SparseSet_T set)
+{
+        assert(set != NULL);
+
+        return set->dense;
+}
+
+Iter_T SparseSet_iter(SparseSet_T set)
+{
+        assert(set != NULL);
+
+        return Vector_iter(set->dense);
+}
+
+/*-------------------------------------
+ * Helper/Private Definitions
+ -------------------------------------*/
+static inline int sparse_find(SparseSet_T set, int id)
+{
+        int index = set->sparse[id];
+
+        if (index < Vector_length(set->dense) &&
+            Vector_toint(Vector_data(set->dense)[index]) == id)
+                return index;
+
+        return -1;
+}
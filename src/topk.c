@@ -0,0 +1,215 @@
+/*
+ *      filename:       topk.c
+ *      author:         @keiferchiang
+ *      date:           18 Oct 2026
+ *      version:        0.0.1
+ *
+ *      description:    Implementation of the TopK module
+ *
+ *      note:           The elements held are a binary min-heap of at
+ *                      most k slots, so the least of them, the one a
+ *                      newcomer has to beat, is always at the root.
+ *                      For k much smaller than the input nearly every
+ *                      candidate is turned away by one comparison
+ *                      with the root, and the whole feed costs
+ *                      O(n + m log k) for m replacements.
+ */
+
+#include "topk.h"
+
+/*-------------------------------------
+ * Representation
+ -------------------------------------*/
+struct topk_t {
+        int k;
+        int size;
+        int (*cmp)(void *a, void *b, void *cl);
+        void *cl;
+        void **heap;
+};
+
+/*-------------------------------------
+ * Helper/Private Prototypes
+ -------------------------------------*/
+/*
+ * Sifts heap[i] up a min-heap
+ */
+static void topk_sift_up(void **heap, int i,
+                         int cmp(void *a, void *b, void *cl), void *cl);
+
+/*
+ * Sifts heap[i] down a min-heap of n elements
+ */
+static void topk_sift_down(void **heap, int i, int n,
+                           int cmp(void *a, void *b, void *cl), void *cl);
+
+/*-------------------------------------
+ * Function Definitions
+ -------------------------------------*/
+TopK_T TopK_new(int k, int cmp(void *a, void *b, void *cl), void *cl)
+{
+        TopK_T top;
+
+        assert(k > 0);
+        assert(cmp != NULL);
+
+        top = malloc(sizeof(struct topk_t));
+        assert(top != NULL);
+
+        top->heap = malloc(k * sizeof(void *));
+        assert(top->heap != NULL);
+
+        top->k = k;
+        top->size = 0;
+        top->cmp = cmp;
+        top->cl = cl;
+
+        return top;
+}
+
+void TopK_free(TopK_T *top)
+{
+        assert(top != NULL);
+        assert(*top != NULL);
+
+        free((*top)->heap);
+        free(*top);
+        *top = NULL;
+}
+
+bool TopK_push(TopK_T top, void *elem)
+{
+        assert(top != NULL);
+
+        if (top->size < top->k) {
+                top->heap[top->size] = elem;
+                topk_sift_up(top->heap, top->size++, top->cmp, top->cl);
+                return true;
+        }
+
+        if (top->cmp(elem, top->heap[0], top->cl) <= 0)
+                return false;
+
+        top->heap[0] = elem;
+        topk_sift_down(top->heap, 0, top->size, top->cmp, top->cl);
+
+        return true;
+}
+
+void TopK_push_iter(TopK_T top, Iter_T *iter)
+{
+        void *elem;
+
+        assert(top != NULL);
+        assert(iter != NULL);
+
+        while (Iter_next(iter, &elem))
+                TopK_push(top, elem);
+}
+
+void TopK_push_vector(TopK_T top, Vector_T vec)
+{
+        void **array;
+        int length;
+        int i;
+
+        assert(top != NULL);
+        assert(vec != NULL);
+
+        array = Vector_data(vec);
+        length = Vector_length(vec);
+
+        for (i = 0; i < length; i++)
+                TopK_push(top, array[i]);
+}
+
+void TopK_merge(TopK_T dst, TopK_T src)
+{
+        int i;
+
+        assert(dst != NULL);
+        assert(src != NULL);
+        assert(dst != src);
+
+        for (i = 0; i < src->size; i++)
+                TopK_push(dst, src->heap[i]);
+}
+
+int TopK_length(TopK_T top)
+{
+        assert(top != NULL);
+
+        return top->size;
+}
+
+void *TopK_min(TopK_T top)
+{
+        assert(top != NULL);
+        assert(top->size > 0);
+
+        return top->heap[0];
+}
+
+Vector_T TopK_vector(TopK_T top)
+{
+        Vector_T vec;
+        void **array;
+        void *temp;
+        int n;
+
+        assert(top != NULL);
+
+        vec = Vector_new(top->size);
+        Vector_resize(vec, top->size);
+        array = Vector_data(vec);
+        if (top->size > 0)
+                memcpy(array, top->heap, top->size * sizeof(void *));
+
+        /* popping the min to the back leaves the greatest in front */
+        for (n = top->size - 1; n > 0; n--) {
+                temp = array[0];
+                array[0] = array[n];
+                array[n] = temp;
+                topk_sift_down(array, 0, n, top->cmp, top->cl);
+        }
+
+        return vec;
+}
+
+/*-------------------------------------
+ * Helper/Private Definitions
+ -------------------------------------*/
+static void topk_sift_up(void **heap, int i,
+                         int cmp(void *a, void *b, void *cl), void *cl)
+{
+        void *elem = heap[i];
+        int parent;
+
+        while (i > 0) {
+                parent = (i - 1) / 2;
+                if (cmp(heap[parent], elem, cl) <= 0)
+                        break;
+                heap[i] = heap[parent];
+                i = parent;
+        }
+
+        heap[i] = elem;
+}
+
+static void topk_sift_down(void **heap, int i, int n,
+                           int cmp(void *a, void *b, void *cl), void *cl)
+{
+        void *elem = heap[i];
+        int child;
+
+        while ((child = 2 * i + 1) < n) {
+                if (child + 1 < n && cmp(heap[child + 1], heap[child], cl) < 0)
+                        child++;
+                if (cmp(elem, heap[child], cl) <= 0)
+                        break;
+                heap[i] = heap[child];
+                i = child;
+        }
+
+        heap[i] = elem;
+}
@@ -9,6 +9,11 @@
 
 #include "vector.h"
 
+/*-------------------------------------
+ * Constants
+ -------------------------------------*/
+#define CACHE_CLASSES   32
+
 /*-------------------------------------
  * Representation
  -------------------------------------*/
@@ -18,8 +23,31 @@ struct vector_t {
         Array_T array;
         int capacity;
         int size;
+        Arena_T arena;
+        void (*free_elem)(void *elem, void *cl);
+        void (*free_batch)(void **elems, int length, void *cl);
+        void *free_cl;
+        uint64_t *tombs;
+        int tomb_words;
+        int ntombs;
 };
 
+/*
+ * A thread's cache of heap backing arrays. Class k holds arrays of
+ * 2^k - 1 slots, the capacities expand steps through, chained
+ * through their first slot. A limit of 0 disables the cache
+ */
+typedef struct buffer_cache_t {
+        Array_T head[CACHE_CLASSES];
+        int count[CACHE_CLASSES];
+        int limit;
+} Buffer_Cache_T;
+
+/*-------------------------------------
+ * Globals
+ -------------------------------------*/
+static __thread Buffer_Cache_T buffer_cache;
+
 /*-------------------------------------
  * Helper/Private Prototypes
  -------------------------------------*/
@@ -28,6 +56,38 @@ struct vector_t {
  */
 static inline void expand(Vector_T vec);
 
+/*
+ * Moves the elements to a new backing array of the given, larger
+ * capacity
+ */
+static inline void grow(Vector_T vec, int capacity);
+
+/*
+ * Allocates a backing array of at least *capacity slots from the
+ * Vector's Arena, the thread's cache or the heap, storing the
+ * number of slots it really has in *capacity
+ */
+static inline Array_T array_new(Vector_T vec, int *capacity);
+
+/*
+ * Returns a heap backing array to the thread's cache if it has room
+ * for it, else to the system
+ */
+static inline void array_release(Vector_T vec, Array_T array,
+                                 int capacity);
+
+/*
+ * Returns the cache class of the smallest array holding capacity
+ * slots
+ */
+static inline int cache_class(int capacity);
+
+/*
+ * Extends the tombstone bitmap to cover every slot of the backing
+ * array
+ */
+static void tombs_grow(Vector_T vec);
+
 /*-------------------------------------
  * Function Definitions
  -------------------------------------*/
@@ -43,8 +103,38 @@ Vector_T Vector_new(int hint)
 
         vec->capacity = hint;
         vec->size = 0;
-        vec->array = malloc(vec->capacity * sizeof(void *));
-        assert(vec->array != NULL);
+        vec->arena = NULL;
+        vec->free_elem = NULL;
+        vec->free_batch = NULL;
+        vec->free_cl = NULL;
+        vec->tombs = NULL;
+        vec->tomb_words = 0;
+        vec->ntombs = 0;
+        vec->array = array_new(vec, &vec->capacity);
+
+        return vec;
+}
+
+Vector_T Vector_new_arena(int hint, Arena_T arena)
+{
+        Vector_T vec;
+
+        assert(hint >= 0);
+        assert(hint < INT_MAX);
+        assert(arena != NULL);
+
+        vec = Arena_alloc(arena, sizeof(struct vector_t), 0);
+
+        vec->capacity = hint;
+        vec->size = 0;
+        vec->arena = arena;
+        vec->free_elem = NULL;
+        vec->free_batch = NULL;
+        vec->free_cl = NULL;
+        vec->tombs = NULL;
+        vec->tomb_words = 0;
+        vec->ntombs = 0;
+        vec->array = array_new(vec, &vec->capacity);
 
         return vec;
 }
@@ -54,13 +144,59 @@ void Vector_free(Vector_T *vec)
         assert(vec != NULL);
         assert(*vec != NULL);
 
+        if ((*vec)->arena != NULL) {
+                *vec = NULL;
+                return;
+        }
+
         if ((*vec)->array != NULL)
-                free((*vec)->array);
+                array_release(*vec, (*vec)->array, (*vec)->capacity);
+        free((*vec)->tombs);
 
         free(*vec);
         *vec = NULL;
 }
 
+//////////////////////////////////
+//      Ownership Functions     //
+//////////////////////////////////
+void Vector_own(Vector_T vec, void free_elem(void *elem, void *cl),
+                void free_batch(void **elems, int length, void *cl),
+                void *cl)
+{
+        assert(vec != NULL);
+
+        vec->free_elem = free_elem;
+        vec->free_batch = free_batch;
+        vec->free_cl = cl;
+}
+
+void Vector_clear(Vector_T *vec)
+{
+        Vector_T v;
+        int i;
+
+        assert(vec != NULL);
+        assert(*vec != NULL);
+
+        v = *vec;
+
+        if (v->free_batch != NULL) {
+                if (v->size > 0)
+                        v->free_batch(v->array, v->size, v->free_cl);
+        } else if (v->free_elem != NULL) {
+                for (i = 0; i < v->size; i++)
+                        if (v->array[i] != NULL)
+                                v->free_elem(v->array[i], v->free_cl);
+        } else {
+                for (i = 0; i < v->size; i++)
+                        free(v->array[i]);
+        }
+
+        v->size = 0;
+        Vector_free(vec);
+}
+
 //////////////////////////////////
 //      Getter Functions        //
 //////////////////////////////////
@@ -71,6 +207,13 @@ int Vector_length(Vector_T vec)
         return vec->size;
 }
 
+void **Vector_data(Vector_T vec)
+{
+        assert(vec != NULL);
+
+        return vec->array;
+}
+
 void *Vector_get(Vector_T vec, int index)
 {
         assert(vec != NULL);
@@ -121,6 +264,23 @@ void Vector_set(Vector_T vec, void *elem, int index)
         vec->array[index] = elem;
 }
 
+void Vector_resize(Vector_T vec, int length)
+{
+        int i;
+
+        assert(vec != NULL);
+        assert(length >= 0);
+        assert(length < INT_MAX);
+
+        if (length >= vec->capacity)
+                grow(vec, length + 1);
+
+        for (i = vec->size; i < length; i++)
+                vec->array[i] = NULL;
+
+        vec->size = length;
+}
+
 void Vector_append(Vector_T vec, void *elem)
 {
         assert(vec != NULL);
@@ -130,17 +290,15 @@ void Vector_append(Vector_T vec, void *elem)
 
 void Vector_prepend(Vector_T vec, void *elem)
 {
-        int length;
-        int i;
-
         assert(vec != NULL);
 
-        length = vec->size;
-
-        for (i = length; i > 0; i--)
-                Vector_set(vec, Vector_get(vec, i - 1), i);
+        (vec->size)++;
+        if (vec->size >= vec->capacity)
+                expand(vec);
 
-        Vector_set(vec, elem, 0);
+        memmove(vec->array + 1, vec->array,
+                (vec->size - 1) * sizeof(void *));
+        vec->array[0] = elem;
 }
 
 //////////////////////////////////
@@ -148,17 +306,12 @@ void Vector_prepend(Vector_T vec, void *elem)
 //////////////////////////////////
 void Vector_remove(Vector_T vec, int index)
 {
-        int length;
-        int i;
-
         assert(vec != NULL);
         assert(index >= 0);
         assert(index < vec->size);
 
-        length = vec->size;
-
-        for (i = index; i < length - 1; i++)
-                Vector_set(vec, Vector_get(vec, i + 1), i);
+        memmove(vec->array + index, vec->array + index + 1,
+                (vec->size - index - 1) * sizeof(void *));
 
         (vec->size)--;
 }
@@ -179,25 +332,393 @@ void Vector_removelo(Vector_T vec)
         Vector_remove(vec, 0);
 }
 
+void Vector_swap_remove(Vector_T vec, int index)
+{
+        assert(vec != NULL);
+        assert(index >= 0);
+        assert(index < vec->size);
+
+        (vec->size)--;
+        vec->array[index] = vec->array[vec->size];
+}
+
+void Vector_mark_removed(Vector_T vec, int index)
+{
+        uint64_t bit;
+
+        assert(vec != NULL);
+        assert(index >= 0);
+        assert(index < vec->size);
+
+        if (index >= vec->tomb_words * 64)
+                tombs_grow(vec);
+
+        bit = UINT64_C(1) << (index % 64);
+        if ((vec->tombs[index / 64] & bit) == 0) {
+                vec->tombs[index / 64] |= bit;
+                (vec->ntombs)++;
+        }
+}
+
+bool Vector_is_removed(Vector_T vec, int index)
+{
+        assert(vec != NULL);
+        assert(index >= 0);
+        assert(index < vec->size);
+
+        if (index >= vec->tomb_words * 64)
+                return false;
+
+        return (vec->tombs[index / 64] >> (index % 64)) & 1;
+}
+
+int Vector_compact(Vector_T vec)
+{
+        uint64_t bits;
+        int removed;
+        int out = 0;
+        int base, n;
+        int w, b;
+
+        assert(vec != NULL);
+
+        if (vec->ntombs == 0)
+                return 0;
+
+        for (w = 0, base = 0; base < vec->size; w++, base += 64) {
+                n = vec->size - base < 64 ? vec->size - base : 64;
+                bits = w < vec->tomb_words ? vec->tombs[w] : 0;
+
+                /* whole words of survivors move as a block */
+                if (bits == 0) {
+                        if (out != base)
+                                memmove(vec->array + out, vec->array + base,
+                                        n * sizeof(void *));
+                        out += n;
+                        continue;
+                }
+
+                for (b = 0; b < n; b++)
+                        if (((bits >> b) & 1) == 0)
+                                vec->array[out++] = vec->array[base + b];
+                vec->tombs[w] = 0;
+        }
+
+        removed = vec->size - out;
+        vec->size = out;
+        vec->ntombs = 0;
+
+        return removed;
+}
+
+//////////////////////////////////
+//      Iteration Functions     //
+//////////////////////////////////
+Iter_T Vector_iter(Vector_T vec)
+{
+        assert(vec != NULL);
+
+        return Iter_array(vec->array, vec->size);
+}
+
+Vector_T Vector_collect(Iter_T *iter)
+{
+        Vector_T vec;
+        void *elem;
+        int length;
+
+        assert(iter != NULL);
+
+        /* arrays are copied in one go */
+        if (iter->kind == ITER_ARRAY) {
+                length = (int) (iter->end - iter->pos);
+                vec = Vector_new(length);
+                if (length > 0)
+                        memcpy(vec->array, iter->pos,
+                               length * sizeof(void *));
+                vec->size = length;
+                iter->pos = iter->end;
+                return vec;
+        }
+
+        vec = Vector_new(0);
+        while (Iter_next(iter, &elem))
+                Vector_append(vec, elem);
+
+        return vec;
+}
+
+//////////////////////////////////
+//      Stream Functions        //
+//////////////////////////////////
+bool Vector_write(Vector_T vec, FILE *fp, const Serial_Codec_T *codec)
+{
+        Serial_Writer_T writer;
+        int i;
+
+        assert(vec != NULL);
+
+        writer = Serial_writer_new(fp, codec);
+
+        for (i = 0; i < vec->size; i++)
+                if (!Serial_write(writer, vec->array[i]))
+                        break;
+
+        return Serial_writer_free(&writer);
+}
+
+Vector_T Vector_read(FILE *fp, const Serial_Codec_T *codec)
+{
+        Serial_Reader_T reader;
+        Vector_T vec;
+        void *elem;
+        int i;
+
+        reader = Serial_reader_new(fp, codec);
+        if (reader == NULL)
+                return NULL;
+
+        vec = Vector_new(0);
+        while (Serial_read(reader, &elem))
+                Vector_append(vec, elem);
+
+        if (Serial_reader_failed(reader)) {
+                if (codec->free != NULL)
+                        for (i = 0; i < vec->size; i++)
+                                codec->free(vec->array[i], codec->cl);
+                Vector_free(&vec);
+        }
+
+        Serial_reader_free(&reader);
+
+        return vec;
+}
+
+//////////////////////////////////
+//      Gather Functions        //
+//////////////////////////////////
+int Vector_iovec(Vector_T vec, int *index, struct iovec *iov, int iovcnt,
+                 size_t length(void *elem, void *cl), void *cl)
+{
+        struct iovec *last = NULL;
+        char *base;
+        size_t len;
+        int count = 0;
+        int i;
+
+        assert(vec != NULL);
+        assert(index != NULL);
+        assert(*index >= 0 && *index <= vec->size);
+        assert(iov != NULL && iovcnt > 0);
+        assert(length != NULL);
+
+        for (i = *index; i < vec->size; i++) {
+                base = vec->array[i];
+                len = length(base, cl);
+                if (len == 0)
+                        continue;
+
+                if (last != NULL &&
+                    (char *) last->iov_base + last->iov_len == base) {
+                        last->iov_len += len;
+                        continue;
+                }
+
+                if (count == iovcnt)
+                        break;
+
+                last = &iov[count++];
+                last->iov_base = base;
+                last->iov_len = len;
+        }
+
+        *index = i;
+
+        return count;
+}
+
+ssize_t Vector_writev(Vector_T vec, int fd,
+                      size_t length(void *elem, void *cl), void *cl)
+{
+        struct iovec iov[SERIAL_IOV_MAX];
+        ssize_t total = 0;
+        ssize_t n;
+        int index = 0;
+        int count;
+
+        assert(vec != NULL);
+        assert(length != NULL);
+
+        while (index < vec->size) {
+                count = Vector_iovec(vec, &index, iov, SERIAL_IOV_MAX,
+                                     length, cl);
+                n = Serial_writev(fd, iov, count);
+                if (n < 0)
+                        return -1;
+                total += n;
+        }
+
+        return total;
+}
+
+//////////////////////////////////
+//      Buffer Cache            //
+//////////////////////////////////
+void Vector_cache_enable(int limit)
+{
+        assert(limit >= 0);
+
+        Vector_cache_trim(limit);
+        buffer_cache.limit = limit;
+}
+
+void Vector_cache_trim(int keep)
+{
+        Array_T array;
+        int k;
+
+        assert(keep >= 0);
+
+        for (k = 0; k < CACHE_CLASSES; k++) {
+                while (buffer_cache.count[k] > keep) {
+                        array = buffer_cache.head[k];
+                        buffer_cache.head[k] = array[0];
+                        buffer_cache.count[k]--;
+                        free(array);
+                }
+        }
+}
+
+size_t Vector_cache_bytes(void)
+{
+        size_t bytes = 0;
+        int k;
+
+        for (k = 0; k < CACHE_CLASSES; k++)
+                bytes += buffer_cache.count[k] * (((size_t) 1 << k) - 1) *
+                         sizeof(void *);
+
+        return bytes;
+}
+
+void Vector_cache_free(void)
+{
+        Vector_cache_enable(0);
+}
+
 /*-------------------------------------
  * Helper/Private Definitions
  -------------------------------------*/
 static inline void expand(Vector_T vec)
+{
+        assert(vec != NULL);
+
+        grow(vec, (vec->capacity * 2) + 1);
+}
+
+static inline void grow(Vector_T vec, int capacity)
 {
         Array_T new_arr;
-        int new_cap;
 
         assert(vec != NULL);
+        assert(capacity > vec->capacity);
 
-        new_cap = (vec->capacity * 2) + 1;
-        new_arr = malloc(new_cap * sizeof(void *));
-        assert(new_arr != NULL);
+        new_arr = array_new(vec, &capacity);
 
+        /* size may already count the slot being filled */
         if (vec->capacity != 0)
-                memcpy(new_arr, vec->array, vec->size *
+                memcpy(new_arr, vec->array, vec->capacity *
                        sizeof(void *));
 
-        free(vec->array);
+        array_release(vec, vec->array, vec->capacity);
         vec->array = new_arr;
-        vec->capacity = new_cap;
+        vec->capacity = capacity;
+}
+
+static void tombs_grow(Vector_T vec)
+{
+        uint64_t *tombs;
+        int words;
+
+        assert(vec != NULL);
+
+        words = (vec->capacity + 63) / 64;
+        if (vec->arena != NULL) {
+                tombs = Arena_alloc(vec->arena, words * sizeof(uint64_t),
+                                    sizeof(uint64_t));
+        } else {
+                tombs = malloc(words * sizeof(uint64_t));
+                assert(tombs != NULL);
+        }
+
+        if (vec->tomb_words > 0)
+                memcpy(tombs, vec->tombs, vec->tomb_words * sizeof(uint64_t));
+        memset(tombs + vec->tomb_words, 0,
+               (words - vec->tomb_words) * sizeof(uint64_t));
+
+        if (vec->arena == NULL)
+                free(vec->tombs);
+        vec->tombs = tombs;
+        vec->tomb_words = words;
+}
+
+static inline Array_T array_new(Vector_T vec, int *capacity)
+{
+        Array_T array;
+        int k;
+
+        assert(vec != NULL);
+
+        if (vec->arena != NULL)
+                return Arena_alloc(vec->arena, *capacity * sizeof(void *),
+                                   sizeof(void *));
+
+        if (buffer_cache.limit > 0 && *capacity > 0) {
+                k = cache_class(*capacity);
+                *capacity = (int) ((1u << k) - 1);
+                if (buffer_cache.head[k] != NULL) {
+                        array = buffer_cache.head[k];
+                        buffer_cache.head[k] = array[0];
+                        buffer_cache.count[k]--;
+                        return array;
+                }
+        }
+
+        array = malloc(*capacity * sizeof(void *));
+        assert(array != NULL);
+
+        return array;
+}
+
+static inline void array_release(Vector_T vec, Array_T array,
+                                 int capacity)
+{
+        unsigned slots = (unsigned) capacity;
+        int k;
+
+        if (vec->arena != NULL)
+                return;
+
+        /* arrays allocated while the cache was off may be any size */
+        if (buffer_cache.limit > 0 && slots > 0 && (slots & (slots + 1)) == 0) {
+                k = cache_class(capacity);
+                if (buffer_cache.count[k] < buffer_cache.limit) {
+                        array[0] = buffer_cache.head[k];
+                        buffer_cache.head[k] = array;
+                        buffer_cache.count[k]++;
+                        return;
+                }
+        }
+
+        free(array);
+}
+
+static inline int cache_class(int capacity)
+{
+        int k = 0;
+
+        while ((unsigned) capacity >> k)
+                k++;
+
+        return k;
 }
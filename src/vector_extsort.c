@@ -0,0 +1,473 @@
+/*
+ *      filename:       vector_extsort.c
+ *      author:         @keiferchiang
+ *      date:           18 Oct 2026
+ *      version:        0.0.1
+ *
+ *      description:    Implementation of the external Vector sort
+ *
+ *      note:           Runs live in tmpfile()s, so the system deletes
+ *                      them even if the process dies. Each run file
+ *                      gets a RUN_BUFFER stdio buffer, and is flagged
+ *                      for sequential access before merging so the
+ *                      kernel reads ahead of the merge asynchronously
+ *                      with a wider window. The merge itself is
+ *                      single-threaded and CPU-light; it mostly waits
+ *                      on that read-ahead.
+ *
+ *                      Runs are merged with a loser tree: tree[0]
+ *                      holds the index of the run whose head is the
+ *                      least, and each internal node the loser of the
+ *                      match played there. Advancing the winner
+ *                      replays only the matches on its path to the
+ *                      root, log2 k comparisons per element rather
+ *                      than the 2 log2 k of a binary heap's sift.
+ *                      More than MAX_FANIN runs are first merged in
+ *                      groups into longer runs, to bound open files
+ *                      and buffer memory.
+ *
+ *      design:         tree[0]           overall winner
+ *                      tree[1 .. k)      losers of internal matches
+ *                      leaves k .. 2k-1  runs 0 .. k-1
+ */
+
+#ifndef _DEFAULT_SOURCE
+#define _DEFAULT_SOURCE
+#endif
+
+#include <fcntl.h>
+
+#include "vector_extsort.h"
+
+/*-------------------------------------
+ * Constants
+ -------------------------------------*/
+#define MAX_FANIN       128
+#define RUN_BUFFER      (1 << 18)
+
+/*-------------------------------------
+ * Representation
+ -------------------------------------*/
+typedef struct run_t {
+        FILE *fp;
+        Serial_Reader_T reader;
+        void *head;
+        bool done;
+} Run_T;
+
+typedef struct merge_t {
+        Run_T *runs;
+        int k;
+        int *tree;
+        int (*cmp)(void *a, void *b, void *cl);
+        void *cl;
+        bool failed;
+} Merge_T;
+
+struct vector_extsort_t {
+        Serial_Codec_T codec;
+        Vector_T memory;
+        int memory_pos;
+        Merge_T merge;
+};
+
+/*-------------------------------------
+ * Helper/Private Prototypes
+ -------------------------------------*/
+/*
+ * Writes the sorted elements of vec to a new temporary file and
+ * releases them. Returns false if the file cannot be made or written
+ */
+static bool run_spill(Run_T *run, Vector_T vec, const Serial_Codec_T *codec);
+
+/*
+ * Rewinds a spilled run for reading and loads its first element
+ */
+static void run_start(Run_T *run, const Serial_Codec_T *codec);
+
+/*
+ * Loads the next element of a run into its head. Returns false on a
+ * read or format error
+ */
+static bool run_advance(Run_T *run);
+
+/*
+ * Releases a run's unread head and closes its file
+ */
+static void run_close(Run_T *run, const Serial_Codec_T *codec);
+
+/*
+ * Starts the runs of a merge and plays the initial tournament
+ */
+static void merge_init(Merge_T *merge);
+
+/*
+ * Plays the matches of the subtree at node t, recording the losers,
+ * and returns its winner
+ */
+static int merge_build(Merge_T *merge, int t);
+
+/*
+ * Removes the least head of the merge into *elem. Returns false
+ * once every run is exhausted or on an error
+ */
+static bool merge_next(Merge_T *merge, void **elem);
+
+/*
+ * Returns true if run x's head comes before run y's. Exhausted runs
+ * come last and ties go to the earlier run
+ */
+static inline bool merge_beats(Merge_T *merge, int x, int y);
+
+/*
+ * Merges groups of MAX_FANIN runs into single runs until at most
+ * MAX_FANIN remain. Returns false if a run cannot be written
+ */
+static bool merge_passes(Vector_Extsort_T sort);
+
+/*
+ * Iter_func callback yielding the sorted elements
+ */
+static bool extsort_next(Iter_T *iter, void **elem);
+
+/*-------------------------------------
+ * Function Definitions
+ -------------------------------------*/
+Vector_Extsort_T Vector_external_sort(Iter_T *input,
+                                      int cmp(void *a, void *b, void *cl),
+                                      void *cl, const Serial_Codec_T *codec,
+                                      int run_length)
+{
+        Vector_Extsort_T sort;
+        Vector_T batch;
+        Run_T *runs;
+        void *elem;
+        int capacity = 0;
+        int i;
+
+        assert(input != NULL);
+        assert(cmp != NULL);
+        assert(codec != NULL);
+        assert(codec->encode != NULL && codec->decode != NULL);
+        assert(run_length > 0);
+
+        sort = calloc(1, sizeof(struct vector_extsort_t));
+        assert(sort != NULL);
+
+        sort->codec = *codec;
+        sort->merge.cmp = cmp;
+        sort->merge.cl = cl;
+
+        batch = Vector_new(0);
+
+        for (;;) {
+                Vector_resize(batch, 0);
+                while (Vector_length(batch) < run_length &&
+                       Iter_next(input, &elem))
+                        Vector_append(batch, elem);
+
+                /* everything fit in memory: no files at all */
+                if (sort->merge.k == 0 && Vector_length(batch) < run_length) {
+                        Vector_sort(batch, cmp, cl);
+                        sort->memory = batch;
+                        return sort;
+                }
+                if (Vector_length(batch) == 0)
+                        break;
+
+                if (sort->merge.k == capacity) {
+                        capacity = 2 * capacity + 8;
+                        runs = realloc(sort->merge.runs,
+                                       capacity * sizeof(Run_T));
+                        assert(runs != NULL);
+                        sort->merge.runs = runs;
+                }
+
+                Vector_sort(batch, cmp, cl);
+                if (!run_spill(&sort->merge.runs[sort->merge.k], batch,
+                               &sort->codec)) {
+                        sort->memory = batch;
+                        Vector_extsort_free(&sort);
+                        return NULL;
+                }
+                sort->merge.k++;
+        }
+
+        Vector_free(&batch);
+
+        if (!merge_passes(sort)) {
+                Vector_extsort_free(&sort);
+                return NULL;
+        }
+
+        for (i = 0; i < sort->merge.k; i++)
+                run_start(&sort->merge.runs[i], &sort->codec);
+        merge_init(&sort->merge);
+
+        return sort;
+}
+
+Iter_T Vector_extsort_iter(Vector_Extsort_T sort)
+{
+        assert(sort != NULL);
+
+        return Iter_func(extsort_next, sort);
+}
+
+bool Vector_extsort_failed(Vector_Extsort_T sort)
+{
+        assert(sort != NULL);
+
+        return sort->merge.failed;
+}
+
+void Vector_extsort_free(Vector_Extsort_T *sort)
+{
+        Vector_Extsort_T s;
+        int i;
+
+        assert(sort != NULL);
+        assert(*sort != NULL);
+
+        s = *sort;
+
+        if (s->memory != NULL) {
+                if (s->codec.free != NULL)
+                        for (i = s->memory_pos; i < Vector_length(s->memory);
+                             i++)
+                                s->codec.free(Vector_get(s->memory, i),
+                                              s->codec.cl);
+                Vector_free(&s->memory);
+        }
+
+        for (i = 0; i < s->merge.k; i++)
+                run_close(&s->merge.runs[i], &s->codec);
+
+        free(s->merge.runs);
+        free(s->merge.tree);
+        free(s);
+        *sort = NULL;
+}
+
+/*-------------------------------------
+ * Helper/Private Definitions
+ -------------------------------------*/
+static bool run_spill(Run_T *run, Vector_T vec, const Serial_Codec_T *codec)
+{
+        Serial_Writer_T writer;
+        bool ok;
+        int i;
+
+        memset(run, 0, sizeof(Run_T));
+        run->done = true;
+
+        run->fp = tmpfile();
+        if (run->fp == NULL)
+                return false;
+        setvbuf(run->fp, NULL, _IOFBF, RUN_BUFFER);
+
+        writer = Serial_writer_new(run->fp, codec);
+        for (i = 0; i < Vector_length(vec); i++)
+                if (!Serial_write(writer, Vector_get(vec, i)))
+                        break;
+        ok = Serial_writer_free(&writer);
+
+        if (!ok) {
+                fclose(run->fp);
+                run->fp = NULL;
+                return false;
+        }
+
+        if (codec->free != NULL)
+                for (i = 0; i < Vector_length(vec); i++)
+                        codec->free(Vector_get(vec, i), codec->cl);
+        Vector_resize(vec, 0);
+
+        return true;
+}
+
+static void run_start(Run_T *run, const Serial_Codec_T *codec)
+{
+        rewind(run->fp);
+
+#ifdef POSIX_FADV_SEQUENTIAL
+        posix_fadvise(fileno(run->fp), 0, 0, POSIX_FADV_SEQUENTIAL);
+        posix_fadvise(fileno(run->fp), 0, 4 * RUN_BUFFER,
+                      POSIX_FADV_WILLNEED);
+#endif
+
+        run->reader = Serial_reader_new(run->fp, codec);
+        run->done = run->reader == NULL;
+}
+
+static bool run_advance(Run_T *run)
+{
+        if (run->done)
+                return true;
+
+        if (!Serial_read(run->reader, &run->head)) {
+                run->done = true;
+                return !Serial_reader_failed(run->reader);
+        }
+
+        return true;
+}
+
+static void run_close(Run_T *run, const Serial_Codec_T *codec)
+{
+        if (!run->done && codec->free != NULL)
+                codec->free(run->head, codec->cl);
+
+        if (run->reader != NULL)
+                Serial_reader_free(&run->reader);
+        if (run->fp != NULL)
+                fclose(run->fp);
+
+        memset(run, 0, sizeof(Run_T));
+        run->done = true;
+}
+
+static void merge_init(Merge_T *merge)
+{
+        int i;
+
+        for (i = 0; i < merge->k; i++)
+                if (merge->runs[i].reader == NULL ||
+                    !run_advance(&merge->runs[i]))
+                        merge->failed = true;
+
+        free(merge->tree);
+        merge->tree = malloc((merge->k > 0 ? merge->k : 1) * sizeof(int));
+        assert(merge->tree != NULL);
+
+        if (merge->k > 0)
+                merge->tree[0] = merge_build(merge, 1);
+}
+
+static int merge_build(Merge_T *merge, int t)
+{
+        int left, right;
+
+        if (t >= merge->k)
+                return t - merge->k;
+
+        left = merge_build(merge, 2 * t);
+        right = merge_build(merge, 2 * t + 1);
+
+        if (merge_beats(merge, left, right)) {
+                merge->tree[t] = right;
+                return left;
+        }
+
+        merge->tree[t] = left;
+        return right;
+}
+
+static bool merge_next(Merge_T *merge, void **elem)
+{
+        int winner;
+        int loser;
+        int t;
+
+        if (merge->k == 0 || merge->failed)
+                return false;
+
+        winner = merge->tree[0];
+        if (merge->runs[winner].done)
+                return false;
+
+        *elem = merge->runs[winner].head;
+        if (!run_advance(&merge->runs[winner]))
+                merge->failed = true;
+
+        for (t = (winner + merge->k) / 2; t > 0; t /= 2) {
+                loser = merge->tree[t];
+                if (merge_beats(merge, loser, winner)) {
+                        merge->tree[t] = winner;
+                        winner = loser;
+                }
+        }
+        merge->tree[0] = winner;
+
+        return true;
+}
+
+static inline bool merge_beats(Merge_T *merge, int x, int y)
+{
+        int c;
+
+        if (merge->runs[x].done)
+                return false;
+        if (merge->runs[y].done)
+                return true;
+
+        c = merge->cmp(merge->runs[x].head, merge->runs[y].head, merge->cl);
+
+        return c < 0 || (c == 0 && x < y);
+}
+
+static bool merge_passes(Vector_Extsort_T sort)
+{
+        Serial_Writer_T writer;
+        Merge_T group;
+        Run_T *runs = sort->merge.runs;
+        Run_T out;
+        void *elem;
+        bool ok;
+        int i;
+
+        while (sort->merge.k > MAX_FANIN) {
+                group = sort->merge;
+                group.k = MAX_FANIN;
+                group.tree = NULL;
+
+                for (i = 0; i < MAX_FANIN; i++)
+                        run_start(&runs[i], &sort->codec);
+                merge_init(&group);
+
+                memset(&out, 0, sizeof(Run_T));
+                out.fp = tmpfile();
+                ok = out.fp != NULL;
+                if (ok) {
+                        setvbuf(out.fp, NULL, _IOFBF, RUN_BUFFER);
+                        writer = Serial_writer_new(out.fp, &sort->codec);
+                        while (merge_next(&group, &elem)) {
+                                Serial_write(writer, elem);
+                                if (sort->codec.free != NULL)
+                                        sort->codec.free(elem,
+                                                         sort->codec.cl);
+                        }
+                        ok = Serial_writer_free(&writer) && !group.failed;
+                }
+
+                free(group.tree);
+                for (i = 0; i < MAX_FANIN; i++)
+                        run_close(&runs[i], &sort->codec);
+
+                /* the merged run joins the back of the queue */
+                memmove(runs, runs + MAX_FANIN,
+                        (sort->merge.k - MAX_FANIN) * sizeof(Run_T));
+                sort->merge.k -= MAX_FANIN;
+                out.done = true;
+                runs[sort->merge.k++] = out;
+
+                if (!ok)
+                        return false;
+        }
+
+        return true;
+}
+
+static bool extsort_next(Iter_T *iter, void **elem)
+{
+        Vector_Extsort_T sort = iter->state;
+
+        if (sort->memory != NULL) {
+                if (sort->memory_pos == Vector_length(sort->memory))
+                        return false;
+                *elem = Vector_get(sort->memory, sort->memory_pos++);
+                return true;
+        }
+
+        return merge_next(&sort->merge, elem);
+}
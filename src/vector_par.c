@@ -0,0 +1,372 @@
+/*
+ *      filename:       vector_par.c
+ *      author:         @keiferchiang
+ *      date:           18 Oct 2026
+ *      version:        0.0.1
+ *
+ *      description:    Implementation of the parallel Vector functions
+ *
+ *      note:           Each function is two parallel passes around a
+ *                      short serial one:
+ *
+ *                      1. every block computes a summary (its sum, or
+ *                         how many of its elements satisfy pred)
+ *                      2. the summaries are scanned into per-block
+ *                         offsets on the calling thread
+ *                      3. every block writes its output starting at
+ *                         its offset
+ *
+ *                      Block sums use several independent
+ *                      accumulators so the reduction vectorizes; the
+ *                      scan pass is a dependent chain and is bound by
+ *                      memory bandwidth anyway.
+ */
+
+#ifndef _DEFAULT_SOURCE
+#define _DEFAULT_SOURCE
+#endif
+
+#include <pthread.h>
+#include <unistd.h>
+
+#include "vector_par.h"
+
+/*-------------------------------------
+ * Constants
+ -------------------------------------*/
+#define MAX_THREADS     64
+#define MIN_BLOCK       (1 << 15)
+
+/*-------------------------------------
+ * Representation
+ -------------------------------------*/
+typedef struct task_t {
+        void **array;
+        int lo;
+        int hi;
+        uintptr_t sum;
+        bool inclusive;
+        bool (*pred)(void *elem, void *cl);
+        void *cl;
+        unsigned char *flags;
+        int count;
+        int true_at;
+        int false_at;
+        void **dst;
+} Task_T;
+
+typedef struct thread_arg_t {
+        void (*worker)(void *task);
+        void *task;
+} Thread_Arg_T;
+
+/*-------------------------------------
+ * Helper/Private Prototypes
+ -------------------------------------*/
+/*
+ * Step 1 of Vector_scan: sums a block
+ */
+static void sum_block(void *task);
+
+/*
+ * Step 3 of Vector_scan: scans a block from its offset
+ */
+static void scan_block(void *task);
+
+/*
+ * Step 1 of Vector_partition and Vector_filter: evaluates pred over
+ * a block, recording the results in flags
+ */
+static void flag_block(void *task);
+
+/*
+ * Step 3 of Vector_partition and Vector_filter: copies a block's
+ * elements to their places in dst. Elements failing pred are
+ * dropped when dst has no room reserved for them
+ */
+static void scatter_block(void *task);
+
+/*
+ * Splits [0, length) into nblocks tasks over array
+ */
+static void tasks_init(Task_T *tasks, int nblocks, void **array,
+                       int length);
+
+/*
+ * Shared body of Vector_partition and Vector_filter. Writes the
+ * elements satisfying pred to out, or back over vec, followed by
+ * the others if keep_false. Returns the number satisfying pred
+ */
+static int split(Vector_T vec, bool pred(void *elem, void *cl), void *cl,
+                 int nthreads, Vector_T out, bool keep_false);
+
+/*
+ * Thread entry point running a Vector_par_run task
+ */
+static void *thread_main(void *arg);
+
+/*-------------------------------------
+ * Function Definitions
+ -------------------------------------*/
+intptr_t Vector_scan(Vector_T vec, bool inclusive, int nthreads)
+{
+        Task_T tasks[MAX_THREADS];
+        uintptr_t offset = 0;
+        uintptr_t sum;
+        int nblocks;
+        int t;
+
+        assert(vec != NULL);
+
+        nblocks = Vector_par_blocks(Vector_length(vec), nthreads);
+        tasks_init(tasks, nblocks, Vector_data(vec), Vector_length(vec));
+
+        Vector_par_run(sum_block, tasks, sizeof(Task_T), nblocks);
+
+        for (t = 0; t < nblocks; t++) {
+                sum = tasks[t].sum;
+                tasks[t].sum = offset;
+                tasks[t].inclusive = inclusive;
+                offset += sum;
+        }
+
+        Vector_par_run(scan_block, tasks, sizeof(Task_T), nblocks);
+
+        return (intptr_t) offset;
+}
+
+int Vector_partition(Vector_T vec, bool pred(void *elem, void *cl),
+                     void *cl, int nthreads)
+{
+        assert(vec != NULL);
+        assert(pred != NULL);
+
+        return split(vec, pred, cl, nthreads, NULL, true);
+}
+
+Vector_T Vector_filter(Vector_T vec, bool pred(void *elem, void *cl),
+                       void *cl, int nthreads)
+{
+        Vector_T out;
+
+        assert(vec != NULL);
+        assert(pred != NULL);
+
+        out = Vector_new(0);
+        split(vec, pred, cl, nthreads, out, false);
+
+        return out;
+}
+
+//////////////////////////////////
+//      Thread Functions        //
+//////////////////////////////////
+int Vector_par_blocks(int length, int nthreads)
+{
+        long ncpus;
+
+        assert(length >= 0);
+
+        if (nthreads <= 0) {
+                ncpus = sysconf(_SC_NPROCESSORS_ONLN);
+                nthreads = ncpus > 0 ? (int) ncpus : 1;
+        }
+
+        if (nthreads > MAX_THREADS)
+                nthreads = MAX_THREADS;
+        if (nthreads > length / MIN_BLOCK)
+                nthreads = length / MIN_BLOCK;
+
+        return nthreads > 1 ? nthreads : 1;
+}
+
+void Vector_par_run(void worker(void *task), void *tasks, size_t size,
+                    int ntasks)
+{
+        pthread_t threads[MAX_THREADS];
+        Thread_Arg_T args[MAX_THREADS];
+        bool started[MAX_THREADS];
+        int t;
+
+        assert(worker != NULL);
+        assert(tasks != NULL);
+        assert(ntasks > 0 && ntasks <= MAX_THREADS);
+
+        for (t = 1; t < ntasks; t++) {
+                args[t].worker = worker;
+                args[t].task = (char *) tasks + t * size;
+                started[t] = pthread_create(&threads[t], NULL, thread_main,
+                                            &args[t]) == 0;
+                if (!started[t]) //out of threads: run it here instead
+                        worker(args[t].task);
+        }
+
+        worker(tasks);
+
+        for (t = 1; t < ntasks; t++)
+                if (started[t])
+                        pthread_join(threads[t], NULL);
+}
+
+/*-------------------------------------
+ * Helper/Private Definitions
+ -------------------------------------*/
+static void sum_block(void *task)
+{
+        Task_T *t = task;
+        uintptr_t acc[4] = { 0, 0, 0, 0 };
+        int i;
+
+        for (i = t->lo; i + 4 <= t->hi; i += 4) {
+                acc[0] += (uintptr_t) t->array[i];
+                acc[1] += (uintptr_t) t->array[i + 1];
+                acc[2] += (uintptr_t) t->array[i + 2];
+                acc[3] += (uintptr_t) t->array[i + 3];
+        }
+        for (; i < t->hi; i++)
+                acc[0] += (uintptr_t) t->array[i];
+
+        t->sum = acc[0] + acc[1] + acc[2] + acc[3];
+}
+
+static void scan_block(void *task)
+{
+        Task_T *t = task;
+        uintptr_t acc = t->sum;
+        uintptr_t value;
+        int i;
+
+        if (t->inclusive) {
+                for (i = t->lo; i < t->hi; i++) {
+                        acc += (uintptr_t) t->array[i];
+                        t->array[i] = (void *) acc;
+                }
+        } else {
+                for (i = t->lo; i < t->hi; i++) {
+                        value = (uintptr_t) t->array[i];
+                        t->array[i] = (void *) acc;
+                        acc += value;
+                }
+        }
+}
+
+static void flag_block(void *task)
+{
+        Task_T *t = task;
+        int count = 0;
+        int i;
+
+        for (i = t->lo; i < t->hi; i++) {
+                t->flags[i] = t->pred(t->array[i], t->cl);
+                count += t->flags[i];
+        }
+
+        t->count = count;
+}
+
+static void scatter_block(void *task)
+{
+        Task_T *t = task;
+        int true_at = t->true_at;
+        int false_at = t->false_at;
+        int i;
+
+        if (false_at < 0) {
+                for (i = t->lo; i < t->hi; i++)
+                        if (t->flags[i])
+                                t->dst[true_at++] = t->array[i];
+                return;
+        }
+
+        for (i = t->lo; i < t->hi; i++) {
+                if (t->flags[i])
+                        t->dst[true_at++] = t->array[i];
+                else
+                        t->dst[false_at++] = t->array[i];
+        }
+}
+
+static void tasks_init(Task_T *tasks, int nblocks, void **array,
+                       int length)
+{
+        int t;
+
+        for (t = 0; t < nblocks; t++) {
+                memset(&tasks[t], 0, sizeof(Task_T));
+                tasks[t].array = array;
+                tasks[t].lo = (int) ((long long) length * t / nblocks);
+                tasks[t].hi = (int) ((long long) length * (t + 1) /
+                                     nblocks);
+        }
+}
+
+static int split(Vector_T vec, bool pred(void *elem, void *cl), void *cl,
+                 int nthreads, Vector_T out, bool keep_false)
+{
+        Task_T tasks[MAX_THREADS];
+        unsigned char *flags;
+        void **dst;
+        int length;
+        int ntrue = 0;
+        int true_at = 0;
+        int false_at;
+        int nblocks;
+        int t;
+
+        length = Vector_length(vec);
+        if (length == 0)
+                return 0;
+
+        flags = malloc(length);
+        assert(flags != NULL);
+
+        nblocks = Vector_par_blocks(length, nthreads);
+        tasks_init(tasks, nblocks, Vector_data(vec), length);
+        for (t = 0; t < nblocks; t++) {
+                tasks[t].pred = pred;
+                tasks[t].cl = cl;
+                tasks[t].flags = flags;
+        }
+
+        Vector_par_run(flag_block, tasks, sizeof(Task_T), nblocks);
+
+        for (t = 0; t < nblocks; t++)
+                ntrue += tasks[t].count;
+
+        if (out != NULL) {
+                Vector_resize(out, ntrue);
+                dst = Vector_data(out);
+        } else {
+                dst = malloc(length * sizeof(void *));
+                assert(dst != NULL);
+        }
+
+        false_at = ntrue;
+        for (t = 0; t < nblocks; t++) {
+                tasks[t].dst = dst;
+                tasks[t].true_at = true_at;
+                tasks[t].false_at = keep_false ? false_at : -1;
+                true_at += tasks[t].count;
+                false_at += (tasks[t].hi - tasks[t].lo) - tasks[t].count;
+        }
+
+        Vector_par_run(scatter_block, tasks, sizeof(Task_T), nblocks);
+
+        if (out == NULL) {
+                memcpy(Vector_data(vec), dst, length * sizeof(void *));
+                free(dst);
+        }
+
+        free(flags);
+
+        return ntrue;
+}
+
+static void *thread_main(void *arg)
+{
+        Thread_Arg_T *args = arg;
+
+        args->worker(args->task);
+
+        return NULL;
+}
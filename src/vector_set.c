@@ -0,0 +1,546 @@
+/*
+ *      filename:       vector_set.c
+ *      author:         @keiferchiang
+ *      date:           18 Oct 2026
+ *      version:        0.0.1
+ *
+ *      description:    Implementation of the Vector set functions
+ *
+ *      note:           Vector_dedup's set holds the index of each kept
+ *                      element next to 32 bits of its hash, 8 bytes a
+ *                      slot, with linear probing at a load factor of
+ *                      at most 1/2. Most probes of a distinct element
+ *                      end at an empty slot and most mismatches are
+ *                      ruled out by the tag, so eq is rarely called
+ *                      on elements that differ. Hashes are remixed
+ *                      before use so weak client hashes, and raw
+ *                      pointers, still spread over the table.
+ *
+ *                      Vector_dedup_par radix sorts by key, then
+ *                      compacts in two parallel passes like
+ *                      Vector_filter: each block flags the elements
+ *                      whose key differs from their predecessor's,
+ *                      the counts are scanned into offsets, and each
+ *                      block copies its flagged elements out.
+ *
+ *                      The sorted set operations are one merge loop
+ *                      that copies, or skips, each run of elements
+ *                      found in only one input. When an input is at
+ *                      least GALLOP_RATIO times longer than the other,
+ *                      its runs are found by galloping search and
+ *                      copied with memcpy. Balanced intersections of
+ *                      value-typed Vectors step without branching,
+ *                      since which side advances is a coin flip the
+ *                      branch predictor loses. When built for AVX2
+ *                      (e.g. make release OPTFLAGS="-O2 -mavx2") they
+ *                      first compare SET_LANES slots of a against
+ *                      SET_LANES of b at once with GCC vector
+ *                      extensions. Without 256-bit compares the block
+ *                      kernel is slower than the scalar loop, so it is
+ *                      left out.
+ */
+
+#include "vector_set.h"
+
+/*-------------------------------------
+ * Constants
+ -------------------------------------*/
+#define GALLOP_RATIO    8
+#define SET_LANES       4
+
+#if defined(__GNUC__) && defined(__AVX2__)
+#define SET_SIMD        1
+#endif
+
+/*-------------------------------------
+ * Representation
+ -------------------------------------*/
+/* index is 1 + the kept element's index, 0 for an empty slot */
+typedef struct set_slot_t {
+        uint32_t tag;
+        uint32_t index;
+} Set_Slot_T;
+
+#ifdef SET_SIMD
+typedef intptr_t Set_Lanes_T
+        __attribute__((vector_size(SET_LANES * sizeof(intptr_t))));
+#endif
+
+typedef struct set_task_t {
+        void **array;
+        int lo;
+        int hi;
+        uint64_t (*key)(void *elem, void *cl);
+        void *cl;
+        unsigned char *flags;
+        int count;
+        int offset;
+        void **dst;
+} Set_Task_T;
+
+/*-------------------------------------
+ * Helper/Private Prototypes
+ -------------------------------------*/
+/*
+ * Finalizer of splitmix64: spreads every input bit over the output
+ */
+static inline uint64_t set_mix(uint64_t h);
+
+/*
+ * Returns elem's key, or its signed slot value when key is NULL
+ */
+static inline uint64_t set_key(uint64_t key(void *elem, void *cl),
+                               void *elem, void *cl);
+
+/*
+ * Step 1 of Vector_dedup_par: flags the elements of a block whose
+ * key differs from the previous element's
+ */
+static void set_flag_block(void *task);
+
+/*
+ * Step 3 of Vector_dedup_par: copies a block's flagged elements to
+ * dst from its offset
+ */
+static void set_copy_block(void *task);
+
+/*
+ * Merges the sorted sets a and b into out, keeping the elements
+ * only in a, only in b and in both as selected. Returns the number
+ * of elements written
+ */
+static int set_merge(void **a, int na, void **b, int nb, void **out,
+                     bool only_a, bool only_b, bool both,
+                     int cmp(void *x, void *y, void *cl), void *cl);
+
+/*
+ * Intersects the sorted value sets a and b into out, a block of
+ * slots at a time where supported. Returns the number of elements
+ * written
+ */
+static int set_intersect_values(void **a, int na, void **b, int nb,
+                                void **out);
+
+/*
+ * Returns the first index in [lo, hi) whose element is no less
+ * than pivot, or hi, by exponential then binary search from lo
+ */
+static int set_gallop(void **x, int lo, int hi, void *pivot,
+                      int cmp(void *x, void *y, void *cl), void *cl);
+
+/*
+ * Compares signed slot values
+ */
+static int set_cmp_value(void *x, void *y, void *cl);
+
+/*
+ * Shared body of the sorted set operations
+ */
+static Vector_T set_op(Vector_T a, Vector_T b, bool only_a, bool only_b,
+                       bool both, int cmp(void *x, void *y, void *cl),
+                       void *cl);
+
+/*-------------------------------------
+ * Function Definitions
+ -------------------------------------*/
+//////////////////////////////////
+//      Deduplication           //
+//////////////////////////////////
+int Vector_unique(Vector_T vec, bool eq(void *a, void *b, void *cl),
+                  void *cl)
+{
+        void **array;
+        int length;
+        int out;
+        int i;
+
+        assert(vec != NULL);
+
+        array = Vector_data(vec);
+        length = Vector_length(vec);
+        if (length == 0)
+                return 0;
+
+        out = 1;
+        if (eq == NULL) {
+                for (i = 1; i < length; i++)
+                        if (array[i] != array[out - 1])
+                                array[out++] = array[i];
+        } else {
+                for (i = 1; i < length; i++)
+                        if (!eq(array[out - 1], array[i], cl))
+                                array[out++] = array[i];
+        }
+
+        Vector_resize(vec, out);
+
+        return length - out;
+}
+
+int Vector_dedup(Vector_T vec, uint64_t hash(void *elem, void *cl),
+                 bool eq(void *a, void *b, void *cl), void *cl)
+{
+        Set_Slot_T *table;
+        Set_Slot_T *slot;
+        void **array;
+        void *elem;
+        uint64_t h;
+        uint32_t tag;
+        size_t capacity = 1;
+        size_t pos;
+        int length;
+        int out = 0;
+        int i;
+
+        assert(vec != NULL);
+
+        array = Vector_data(vec);
+        length = Vector_length(vec);
+        if (length < 2)
+                return 0;
+
+        while (capacity < 2 * (size_t) length)
+                capacity <<= 1;
+
+        table = calloc(capacity, sizeof(Set_Slot_T));
+        assert(table != NULL);
+
+        for (i = 0; i < length; i++) {
+                elem = array[i];
+                h = set_mix(hash != NULL ? hash(elem, cl)
+                                         : (uint64_t) (uintptr_t) elem);
+                tag = (uint32_t) (h >> 32);
+
+                for (pos = h & (capacity - 1); ;
+                     pos = (pos + 1) & (capacity - 1)) {
+                        slot = &table[pos];
+
+                        if (slot->index == 0) {
+                                slot->tag = tag;
+                                slot->index = out + 1;
+                                array[out++] = elem;
+                                break;
+                        }
+
+                        if (slot->tag == tag &&
+                            (eq != NULL ? eq(array[slot->index - 1], elem, cl)
+                                        : array[slot->index - 1] == elem))
+                                break; //duplicate
+                }
+        }
+
+        free(table);
+        Vector_resize(vec, out);
+
+        return length - out;
+}
+
+int Vector_dedup_par(Vector_T vec, uint64_t key(void *elem, void *cl),
+                     void *cl, int nthreads)
+{
+        Set_Task_T *tasks;
+        unsigned char *flags;
+        void **dst;
+        int length;
+        int nblocks;
+        int out = 0;
+        int t;
+
+        assert(vec != NULL);
+
+        length = Vector_length(vec);
+        if (length < 2)
+                return 0;
+
+        Vector_radix_sort_par(vec, key, cl, nthreads);
+
+        nblocks = Vector_par_blocks(length, nthreads);
+        tasks = malloc(nblocks * sizeof(Set_Task_T));
+        flags = malloc(length);
+        dst = malloc(length * sizeof(void *));
+        assert(tasks != NULL && flags != NULL && dst != NULL);
+
+        for (t = 0; t < nblocks; t++) {
+                tasks[t].array = Vector_data(vec);
+                tasks[t].lo = (int) ((long long) length * t / nblocks);
+                tasks[t].hi = (int) ((long long) length * (t + 1) /
+                                     nblocks);
+                tasks[t].key = key;
+                tasks[t].cl = cl;
+                tasks[t].flags = flags;
+                tasks[t].dst = dst;
+        }
+
+        Vector_par_run(set_flag_block, tasks, sizeof(Set_Task_T), nblocks);
+
+        for (t = 0; t < nblocks; t++) {
+                tasks[t].offset = out;
+                out += tasks[t].count;
+        }
+
+        Vector_par_run(set_copy_block, tasks, sizeof(Set_Task_T), nblocks);
+
+        memcpy(Vector_data(vec), dst, out * sizeof(void *));
+        Vector_resize(vec, out);
+
+        free(dst);
+        free(flags);
+        free(tasks);
+
+        return length - out;
+}
+
+//////////////////////////////////
+//      Sorted Set Operations   //
+//////////////////////////////////
+Vector_T Vector_union(Vector_T a, Vector_T b,
+                      int cmp(void *x, void *y, void *cl), void *cl)
+{
+        assert(a != NULL);
+        assert(b != NULL);
+
+        return set_op(a, b, true, true, true, cmp, cl);
+}
+
+Vector_T Vector_intersect(Vector_T a, Vector_T b,
+                          int cmp(void *x, void *y, void *cl), void *cl)
+{
+        assert(a != NULL);
+        assert(b != NULL);
+
+        return set_op(a, b, false, false, true, cmp, cl);
+}
+
+Vector_T Vector_difference(Vector_T a, Vector_T b,
+                           int cmp(void *x, void *y, void *cl), void *cl)
+{
+        assert(a != NULL);
+        assert(b != NULL);
+
+        return set_op(a, b, true, false, false, cmp, cl);
+}
+
+Vector_T Vector_symdiff(Vector_T a, Vector_T b,
+                        int cmp(void *x, void *y, void *cl), void *cl)
+{
+        assert(a != NULL);
+        assert(b != NULL);
+
+        return set_op(a, b, true, true, false, cmp, cl);
+}
+
+/*-------------------------------------
+ * Helper/Private Definitions
+ -------------------------------------*/
+static Vector_T set_op(Vector_T a, Vector_T b, bool only_a, bool only_b,
+                       bool both, int cmp(void *x, void *y, void *cl),
+                       void *cl)
+{
+        Vector_T out;
+        int na = Vector_length(a);
+        int nb = Vector_length(b);
+        int bound = 0;
+        int n;
+
+        /* the most the result can hold */
+        if (only_a)
+                bound += na;
+        if (only_b)
+                bound += nb;
+        if (both && !only_a && !only_b)
+                bound = na < nb ? na : nb;
+
+        out = Vector_new(0);
+        Vector_resize(out, bound);
+
+        if (cmp == NULL && both && !only_a && !only_b &&
+            na < GALLOP_RATIO * (long) nb && nb < GALLOP_RATIO * (long) na)
+                n = set_intersect_values(Vector_data(a), na, Vector_data(b),
+                                         nb, Vector_data(out));
+        else
+                n = set_merge(Vector_data(a), na, Vector_data(b), nb,
+                              Vector_data(out), only_a, only_b, both,
+                              cmp != NULL ? cmp : set_cmp_value, cl);
+
+        Vector_resize(out, n);
+
+        return out;
+}
+
+static int set_merge(void **a, int na, void **b, int nb, void **out,
+                     bool only_a, bool only_b, bool both,
+                     int cmp(void *x, void *y, void *cl), void *cl)
+{
+        bool gallop_a = na >= GALLOP_RATIO * (long) nb;
+        bool gallop_b = nb >= GALLOP_RATIO * (long) na;
+        int i = 0, j = 0, n = 0;
+        int c, k;
+
+        while (i < na && j < nb) {
+                c = cmp(a[i], b[j], cl);
+
+                if (c < 0) {
+                        k = gallop_a ? set_gallop(a, i + 1, na, b[j], cmp, cl)
+                                     : i + 1;
+                        if (only_a) {
+                                memcpy(out + n, a + i,
+                                       (k - i) * sizeof(void *));
+                                n += k - i;
+                        }
+                        i = k;
+                } else if (c > 0) {
+                        k = gallop_b ? set_gallop(b, j + 1, nb, a[i], cmp, cl)
+                                     : j + 1;
+                        if (only_b) {
+                                memcpy(out + n, b + j,
+                                       (k - j) * sizeof(void *));
+                                n += k - j;
+                        }
+                        j = k;
+                } else {
+                        if (both)
+                                out[n++] = a[i];
+                        i++;
+                        j++;
+                }
+        }
+
+        if (only_a && i < na) {
+                memcpy(out + n, a + i, (na - i) * sizeof(void *));
+                n += na - i;
+        }
+        if (only_b && j < nb) {
+                memcpy(out + n, b + j, (nb - j) * sizeof(void *));
+                n += nb - j;
+        }
+
+        return n;
+}
+
+static int set_intersect_values(void **a, int na, void **b, int nb,
+                                void **out)
+{
+        intptr_t x, y;
+        int i = 0, j = 0, n = 0;
+#ifdef SET_SIMD
+        Set_Lanes_T va, match;
+        int k;
+
+        while (i + SET_LANES <= na && j + SET_LANES <= nb) {
+                memcpy(&va, a + i, sizeof(va));
+
+                /* lane k is all ones if a[i + k] is among b[j, j + 4) */
+                match = va == (Set_Lanes_T) { (intptr_t) b[j],
+                        (intptr_t) b[j], (intptr_t) b[j], (intptr_t) b[j] };
+                for (k = 1; k < SET_LANES; k++)
+                        match |= va == (Set_Lanes_T) { (intptr_t) b[j + k],
+                                (intptr_t) b[j + k], (intptr_t) b[j + k],
+                                (intptr_t) b[j + k] };
+
+                for (k = 0; k < SET_LANES; k++) {
+                        out[n] = a[i + k];
+                        n -= (int) match[k];
+                }
+
+                x = (intptr_t) a[i + SET_LANES - 1];
+                y = (intptr_t) b[j + SET_LANES - 1];
+                i += x <= y ? SET_LANES : 0;
+                j += y <= x ? SET_LANES : 0;
+        }
+#endif
+
+        while (i < na && j < nb) {
+                x = (intptr_t) a[i];
+                y = (intptr_t) b[j];
+
+                /* branch-free: the outcome of each step is random */
+                out[n] = a[i];
+                n += x == y;
+                i += x <= y;
+                j += y <= x;
+        }
+
+        return n;
+}
+
+static int set_gallop(void **x, int lo, int hi, void *pivot,
+                      int cmp(void *x, void *y, void *cl), void *cl)
+{
+        long bound = 1;
+        int left, right, mid;
+
+        /* probe lo, lo + 1, lo + 3, lo + 7, ... until one is no less */
+        while (bound <= hi - lo && cmp(x[lo + bound - 1], pivot, cl) < 0)
+                bound <<= 1;
+
+        left = lo + (int) (bound >> 1);
+        right = bound <= hi - lo ? lo + (int) bound - 1 : hi;
+
+        while (left < right) {
+                mid = left + (right - left) / 2;
+                if (cmp(x[mid], pivot, cl) < 0)
+                        left = mid + 1;
+                else
+                        right = mid;
+        }
+
+        return left;
+}
+
+static int set_cmp_value(void *x, void *y, void *cl)
+{
+        (void) cl;
+
+        return ((intptr_t) x > (intptr_t) y) - ((intptr_t) x < (intptr_t) y);
+}
+
+static inline uint64_t set_mix(uint64_t h)
+{
+        h ^= h >> 30;
+        h *= UINT64_C(0xbf58476d1ce4e5b9);
+        h ^= h >> 27;
+        h *= UINT64_C(0x94d049bb133111eb);
+        h ^= h >> 31;
+
+        return h;
+}
+
+static inline uint64_t set_key(uint64_t key(void *elem, void *cl),
+                               void *elem, void *cl)
+{
+        if (key == NULL)
+                return (uint64_t) (intptr_t) elem;
+
+        return key(elem, cl);
+}
+
+static void set_flag_block(void *task)
+{
+        Set_Task_T *t = task;
+        uint64_t prev, curr;
+        int count = 0;
+        int i;
+
+        /* a block's first element compares with the last of the one before */
+        prev = t->lo > 0 ? set_key(t->key, t->array[t->lo - 1], t->cl) : 0;
+
+        for (i = t->lo; i < t->hi; i++) {
+                curr = set_key(t->key, t->array[i], t->cl);
+                t->flags[i] = i == 0 || curr != prev;
+                count += t->flags[i];
+                prev = curr;
+        }
+
+        t->count = count;
+}
+
+static void set_copy_block(void *task)
+{
+        Set_Task_T *t = task;
+        int offset = t->offset;
+        int i;
+
+        for (i = t->lo; i < t->hi; i++)
+                if (t->flags[i])
+                        t->dst[offset++] = t->array[i];
+}
@@ -0,0 +1,496 @@
+/*
+ *      filename:       vector_sort.c
+ *      author:         @keiferchiang
+ *      date:           18 Oct 2026
+ *      version:        0.0.1
+ *
+ *      description:    Implementation of the Vector sorting functions
+ *
+ *      note:           The radix sort works on (key, element) pairs
+ *                      so each key is extracted once. One pass over
+ *                      the pairs builds the histograms of all eight
+ *                      byte digits; a digit whose histogram has a
+ *                      single non-empty bucket would not move
+ *                      anything and is skipped. Every remaining digit
+ *                      is one stable counting-sort scatter between
+ *                      two pair buffers.
+ *
+ *                      In the parallel sort each thread owns one
+ *                      block of the pairs and keeps its own histogram.
+ *                      A bucket's output range is split between the
+ *                      threads in block order, which keeps the
+ *                      scatter stable without any locking.
+ */
+
+#include "vector_sort.h"
+
+/*-------------------------------------
+ * Constants
+ -------------------------------------*/
+#define DIGIT_BITS      8
+#define RADIX           (1 << DIGIT_BITS)
+#define NDIGITS         (64 / DIGIT_BITS)
+
+/* Ranges this short are finished with insertion sort */
+#define SMALL_RANGE     16
+
+/*-------------------------------------
+ * Representation
+ -------------------------------------*/
+typedef struct pair_t {
+        uint64_t key;
+        void *elem;
+} Pair_T;
+
+typedef struct sort_task_t {
+        void **array;
+        Pair_T *src;
+        Pair_T *dst;
+        int lo;
+        int hi;
+        uint64_t (*key)(void *elem, void *cl);
+        void *cl;
+        int shift;
+        int counts[NDIGITS][RADIX];
+        int offsets[RADIX];
+} Sort_Task_T;
+
+/*-------------------------------------
+ * Helper/Private Prototypes
+ -------------------------------------*/
+/*
+ * Sorts a[lo, hi), switching to heapsort once depth runs out
+ */
+static void introsort(void **a, int lo, int hi, int depth,
+                      int cmp(void *a, void *b, void *cl), void *cl);
+
+/*
+ * Hoare partition of a[lo, hi) around a median-of-three pivot.
+ * Returns p such that no element of a[lo, p] is greater than any
+ * element of a[p + 1, hi), with both sides non-empty
+ */
+static int partition(void **a, int lo, int hi,
+                     int cmp(void *a, void *b, void *cl), void *cl);
+
+/*
+ * Heapsorts a[lo, hi)
+ */
+static void heapsort_range(void **a, int lo, int hi,
+                           int cmp(void *a, void *b, void *cl), void *cl);
+
+/*
+ * Sifts h[root] down a max-heap of n elements
+ */
+static void sort_sift_down(void **h, int root, int n,
+                           int cmp(void *a, void *b, void *cl), void *cl);
+
+/*
+ * Insertion sorts a[lo, hi)
+ */
+static void insertion_sort(void **a, int lo, int hi,
+                           int cmp(void *a, void *b, void *cl), void *cl);
+
+/*
+ * Returns the introsort recursion budget for n elements, 2 log2 n
+ */
+static inline int depth_limit(int n);
+
+/*
+ * Fills a block of pairs from the Vector's slots and histograms
+ * every digit of their keys
+ */
+static void radix_extract(void *task);
+
+/*
+ * Histograms the digit at shift over a block of src into counts[0]
+ */
+static void radix_count(void *task);
+
+/*
+ * Scatters a block of src into dst by the digit at shift
+ */
+static void radix_scatter(void *task);
+
+/*
+ * Copies the elements of a block of src back to the Vector's slots
+ */
+static void radix_store(void *task);
+
+/*-------------------------------------
+ * Function Definitions
+ -------------------------------------*/
+//////////////////////////////////
+//      Comparison Sort         //
+//////////////////////////////////
+void Vector_sort(Vector_T vec, int cmp(void *a, void *b, void *cl),
+                 void *cl)
+{
+        int length;
+
+        assert(vec != NULL);
+        assert(cmp != NULL);
+
+        length = Vector_length(vec);
+        introsort(Vector_data(vec), 0, length, depth_limit(length), cmp,
+                  cl);
+}
+
+void Vector_nth_element(Vector_T vec, int n,
+                        int cmp(void *a, void *b, void *cl), void *cl)
+{
+        void **a;
+        int lo = 0;
+        int hi;
+        int depth;
+        int p;
+
+        assert(vec != NULL);
+        assert(n >= 0 && n < Vector_length(vec));
+        assert(cmp != NULL);
+
+        a = Vector_data(vec);
+        hi = Vector_length(vec);
+        depth = depth_limit(hi);
+
+        while (hi - lo > SMALL_RANGE) {
+                if (depth-- == 0) {
+                        heapsort_range(a, lo, hi, cmp, cl);
+                        return;
+                }
+
+                p = partition(a, lo, hi, cmp, cl);
+                if (n <= p)
+                        hi = p + 1;
+                else
+                        lo = p + 1;
+        }
+
+        insertion_sort(a, lo, hi, cmp, cl);
+}
+
+void Vector_partial_sort(Vector_T vec, int k,
+                         int cmp(void *a, void *b, void *cl), void *cl)
+{
+        assert(vec != NULL);
+        assert(k >= 0);
+        assert(cmp != NULL);
+
+        if (k >= Vector_length(vec)) {
+                Vector_sort(vec, cmp, cl);
+                return;
+        }
+        if (k == 0)
+                return;
+
+        /* everything before index k is now no greater than it */
+        Vector_nth_element(vec, k, cmp, cl);
+        introsort(Vector_data(vec), 0, k, depth_limit(k), cmp, cl);
+}
+
+//////////////////////////////////
+//      Radix Sort              //
+//////////////////////////////////
+void Vector_radix_sort(Vector_T vec, uint64_t key(void *elem, void *cl),
+                       void *cl)
+{
+        Vector_radix_sort_par(vec, key, cl, 1);
+}
+
+void Vector_radix_sort_par(Vector_T vec, uint64_t key(void *elem, void *cl),
+                           void *cl, int nthreads)
+{
+        Sort_Task_T *tasks;
+        Pair_T *pairs[2];
+        Pair_T *temp;
+        int totals[NDIGITS][RADIX];
+        bool first = true;
+        int length;
+        int nblocks;
+        int at;
+        int d, b, t;
+
+        assert(vec != NULL);
+
+        length = Vector_length(vec);
+        if (length < 2)
+                return;
+
+        nblocks = Vector_par_blocks(length, nthreads);
+        tasks = malloc(nblocks * sizeof(Sort_Task_T));
+        pairs[0] = malloc(length * sizeof(Pair_T));
+        pairs[1] = malloc(length * sizeof(Pair_T));
+        assert(tasks != NULL && pairs[0] != NULL && pairs[1] != NULL);
+
+        for (t = 0; t < nblocks; t++) {
+                tasks[t].array = Vector_data(vec);
+                tasks[t].src = pairs[0];
+                tasks[t].dst = pairs[1];
+                tasks[t].lo = (int) ((long long) length * t / nblocks);
+                tasks[t].hi = (int) ((long long) length * (t + 1) /
+                                     nblocks);
+                tasks[t].key = key;
+                tasks[t].cl = cl;
+        }
+
+        Vector_par_run(radix_extract, tasks, sizeof(Sort_Task_T), nblocks);
+
+        memset(totals, 0, sizeof(totals));
+        for (t = 0; t < nblocks; t++)
+                for (d = 0; d < NDIGITS; d++)
+                        for (b = 0; b < RADIX; b++)
+                                totals[d][b] += tasks[t].counts[d][b];
+
+        for (d = 0; d < NDIGITS; d++) {
+                for (b = 0; b < RADIX && totals[d][b] == 0; b++)
+                        ;
+                if (totals[d][b] == length) //every key shares this digit
+                        continue;
+
+                for (t = 0; t < nblocks; t++)
+                        tasks[t].shift = d * DIGIT_BITS;
+
+                /*
+                 * Per-block counts from the extraction pass only hold
+                 * while the pairs are in their original order
+                 */
+                if (first) {
+                        for (t = 0; t < nblocks && d != 0; t++)
+                                memcpy(tasks[t].counts[0],
+                                       tasks[t].counts[d],
+                                       sizeof(tasks[t].counts[0]));
+                        first = false;
+                } else if (nblocks > 1) {
+                        Vector_par_run(radix_count, tasks,
+                                       sizeof(Sort_Task_T), nblocks);
+                } else {
+                        memcpy(tasks[0].counts[0], totals[d],
+                               sizeof(totals[d]));
+                }
+
+                at = 0;
+                for (b = 0; b < RADIX; b++) {
+                        for (t = 0; t < nblocks; t++) {
+                                tasks[t].offsets[b] = at;
+                                at += tasks[t].counts[0][b];
+                        }
+                }
+
+                Vector_par_run(radix_scatter, tasks, sizeof(Sort_Task_T),
+                               nblocks);
+
+                temp = tasks[0].src;
+                for (t = 0; t < nblocks; t++) {
+                        tasks[t].src = tasks[t].dst;
+                        tasks[t].dst = temp;
+                }
+        }
+
+        Vector_par_run(radix_store, tasks, sizeof(Sort_Task_T), nblocks);
+
+        free(pairs[0]);
+        free(pairs[1]);
+        free(tasks);
+}
+
+uint64_t Vector_float_key(double value)
+{
+        uint64_t bits;
+
+        memcpy(&bits, &value, sizeof(bits));
+
+        /* negatives sort in reverse, below every positive */
+        if (bits >> 63)
+                return ~bits;
+
+        return bits | ((uint64_t) 1 << 63);
+}
+
+uint64_t Vector_int_key(int64_t value)
+{
+        return (uint64_t) value ^ ((uint64_t) 1 << 63);
+}
+
+/*-------------------------------------
+ * Helper/Private Definitions
+ -------------------------------------*/
+static void introsort(void **a, int lo, int hi, int depth,
+                      int cmp(void *a, void *b, void *cl), void *cl)
+{
+        int p;
+
+        while (hi - lo > SMALL_RANGE) {
+                if (depth-- == 0) {
+                        heapsort_range(a, lo, hi, cmp, cl);
+                        return;
+                }
+
+                /* recurse into the smaller side, loop on the larger */
+                p = partition(a, lo, hi, cmp, cl);
+                if (p - lo < hi - p) {
+                        introsort(a, lo, p + 1, depth, cmp, cl);
+                        lo = p + 1;
+                } else {
+                        introsort(a, p + 1, hi, depth, cmp, cl);
+                        hi = p + 1;
+                }
+        }
+
+        insertion_sort(a, lo, hi, cmp, cl);
+}
+
+static int partition(void **a, int lo, int hi,
+                     int cmp(void *a, void *b, void *cl), void *cl)
+{
+        void *pivot;
+        void *temp;
+        int mid = lo + (hi - lo - 1) / 2;
+        int i, j;
+
+        /* order a[lo] <= a[mid] <= a[hi - 1] */
+        if (cmp(a[mid], a[lo], cl) < 0) {
+                temp = a[mid]; a[mid] = a[lo]; a[lo] = temp;
+        }
+        if (cmp(a[hi - 1], a[mid], cl) < 0) {
+                temp = a[hi - 1]; a[hi - 1] = a[mid]; a[mid] = temp;
+                if (cmp(a[mid], a[lo], cl) < 0) {
+                        temp = a[mid]; a[mid] = a[lo]; a[lo] = temp;
+                }
+        }
+
+        pivot = a[mid];
+        i = lo - 1;
+        j = hi;
+
+        for (;;) {
+                do
+                        i++;
+                while (cmp(a[i], pivot, cl) < 0);
+                do
+                        j--;
+                while (cmp(a[j], pivot, cl) > 0);
+
+                if (i >= j)
+                        return j;
+
+                temp = a[i];
+                a[i] = a[j];
+                a[j] = temp;
+        }
+}
+
+static void heapsort_range(void **a, int lo, int hi,
+                           int cmp(void *a, void *b, void *cl), void *cl)
+{
+        void **h = a + lo;
+        void *temp;
+        int n = hi - lo;
+        int i;
+
+        for (i = n / 2 - 1; i >= 0; i--)
+                sort_sift_down(h, i, n, cmp, cl);
+
+        for (i = n - 1; i > 0; i--) {
+                temp = h[0];
+                h[0] = h[i];
+                h[i] = temp;
+                sort_sift_down(h, 0, i, cmp, cl);
+        }
+}
+
+static void sort_sift_down(void **h, int root, int n,
+                           int cmp(void *a, void *b, void *cl), void *cl)
+{
+        void *elem = h[root];
+        int child;
+
+        while ((child = 2 * root + 1) < n) {
+                if (child + 1 < n && cmp(h[child], h[child + 1], cl) < 0)
+                        child++;
+                if (cmp(elem, h[child], cl) >= 0)
+                        break;
+                h[root] = h[child];
+                root = child;
+        }
+
+        h[root] = elem;
+}
+
+static void insertion_sort(void **a, int lo, int hi,
+                           int cmp(void *a, void *b, void *cl), void *cl)
+{
+        void *elem;
+        int i, j;
+
+        for (i = lo + 1; i < hi; i++) {
+                elem = a[i];
+                for (j = i; j > lo && cmp(elem, a[j - 1], cl) < 0; j--)
+                        a[j] = a[j - 1];
+                a[j] = elem;
+        }
+}
+
+static inline int depth_limit(int n)
+{
+        int depth = 0;
+
+        while (n > 1) {
+                n >>= 1;
+                depth += 2;
+        }
+
+        return depth;
+}
+
+static void radix_extract(void *task)
+{
+        Sort_Task_T *t = task;
+        uint64_t k;
+        int d, i;
+
+        memset(t->counts, 0, sizeof(t->counts));
+
+        for (i = t->lo; i < t->hi; i++) {
+                if (t->key != NULL)
+                        k = t->key(t->array[i], t->cl);
+                else
+                        k = Vector_int_key(Vector_toint(t->array[i]));
+
+                t->src[i].key = k;
+                t->src[i].elem = t->array[i];
+                for (d = 0; d < NDIGITS; d++)
+                        t->counts[d][(k >> (d * DIGIT_BITS)) &
+                                     (RADIX - 1)]++;
+        }
+}
+
+static void radix_count(void *task)
+{
+        Sort_Task_T *t = task;
+        int *counts = t->counts[0];
+        int i;
+
+        memset(counts, 0, sizeof(t->counts[0]));
+
+        for (i = t->lo; i < t->hi; i++)
+                counts[(t->src[i].key >> t->shift) & (RADIX - 1)]++;
+}
+
+static void radix_scatter(void *task)
+{
+        Sort_Task_T *t = task;
+        int *offsets = t->offsets;
+        int i;
+
+        for (i = t->lo; i < t->hi; i++)
+                t->dst[offsets[(t->src[i].key >> t->shift) &
+                               (RADIX - 1)]++] = t->src[i];
+}
+
+static void radix_store(void *task)
+{
+        Sort_Task_T *t = task;
+        int i;
+
+        for (i = t->lo; i < t->hi; i++)
+                t->array[i] = t->src[i].elem;
+}
@@ -0,0 +1,291 @@
+/*
+ *      filename:       xmastree.c
+ *      author:         @keiferchiang
+ *      date:           18 Oct 2026
+ *      version:        0.0.1
+ *
+ *      description:    Implementation of the XmasTree module
+ *
+ *      note:           Rihani, Sanders and Dementiev's MultiQueue.
+ *                      With QUEUES_PER_THREAD heaps per thread, a
+ *                      random heap is usually free, so threads rarely
+ *                      block one another. Pops lock two distinct
+ *                      random heaps with trylock, which cannot
+ *                      deadlock, and take the lesser of their minima;
+ *                      looking at two heaps rather than one keeps the
+ *                      expected rank of a popped element within a
+ *                      small multiple of the number of heaps.
+ *
+ *                      When random picks keep failing (the locks are
+ *                      busy or the heaps empty), both operations fall
+ *                      back to visiting the heaps in order with a
+ *                      blocking lock, so a pop only reports empty
+ *                      after having seen every heap empty.
+ */
+
+#ifndef _DEFAULT_SOURCE
+#define _DEFAULT_SOURCE
+#endif
+
+#include <pthread.h>
+#include <unistd.h>
+#include <stdint.h>
+
+#include "xmastree.h"
+
+/*-------------------------------------
+ * Constants
+ -------------------------------------*/
+#define QUEUES_PER_THREAD       2
+#define MAX_TREE_THREADS        1024
+#define CACHE_LINE              64
+
+/*-------------------------------------
+ * Representation
+ -------------------------------------*/
+typedef struct xmas_queue_t {
+        pthread_mutex_t lock;
+        Vector_T heap;
+        char pad[CACHE_LINE]; //keeps neighbouring locks apart
+} Xmas_Queue_T;
+
+struct xmastree_t {
+        Xmas_Queue_T *queues;
+        int nqueues;
+        int (*cmp)(void *a, void *b, void *cl);
+        void *cl;
+};
+
+/*-------------------------------------
+ * Globals
+ -------------------------------------*/
+static __thread uint32_t xmas_seed = 0;
+
+/*-------------------------------------
+ * Helper/Private Prototypes
+ -------------------------------------*/
+/*
+ * Returns a random queue index from the calling thread's generator
+ */
+static int xmas_pick(XmasTree_T tree);
+
+/*
+ * Adds elem to a queue's heap. The queue must be locked
+ */
+static void xmas_heap_push(XmasTree_T tree, Xmas_Queue_T *queue,
+                           void *elem);
+
+/*
+ * Removes and returns the minimum of a queue's non-empty heap. The
+ * queue must be locked
+ */
+static void *xmas_heap_pop(XmasTree_T tree, Xmas_Queue_T *queue);
+
+/*-------------------------------------
+ * Function Definitions
+ -------------------------------------*/
+XmasTree_T XmasTree_new(int nthreads, int cmp(void *a, void *b, void *cl),
+                        void *cl)
+{
+        XmasTree_T tree;
+        long ncpus;
+        int q;
+
+        assert(cmp != NULL);
+
+        if (nthreads <= 0) {
+                ncpus = sysconf(_SC_NPROCESSORS_ONLN);
+                nthreads = ncpus > 0 ? (int) ncpus : 1;
+        }
+        if (nthreads > MAX_TREE_THREADS)
+                nthreads = MAX_TREE_THREADS;
+
+        tree = malloc(sizeof(struct xmastree_t));
+        assert(tree != NULL);
+
+        tree->nqueues = QUEUES_PER_THREAD * nthreads;
+        tree->queues = malloc(tree->nqueues * sizeof(Xmas_Queue_T));
+        assert(tree->queues != NULL);
+
+        for (q = 0; q < tree->nqueues; q++) {
+                pthread_mutex_init(&tree->queues[q].lock, NULL);
+                tree->queues[q].heap = Vector_new(0);
+        }
+        tree->cmp = cmp;
+        tree->cl = cl;
+
+        return tree;
+}
+
+void XmasTree_free(XmasTree_T *tree)
+{
+        int q;
+
+        assert(tree != NULL);
+        assert(*tree != NULL);
+
+        for (q = 0; q < (*tree)->nqueues; q++) {
+                pthread_mutex_destroy(&(*tree)->queues[q].lock);
+                Vector_free(&(*tree)->queues[q].heap);
+        }
+        free((*tree)->queues);
+        free(*tree);
+        *tree = NULL;
+}
+
+void XmasTree_push(XmasTree_T tree, void *elem)
+{
+        Xmas_Queue_T *queue;
+        int attempt;
+
+        assert(tree != NULL);
+
+        queue = &tree->queues[xmas_pick(tree)];
+        for (attempt = 1; pthread_mutex_trylock(&queue->lock) != 0;
+             attempt++) {
+                queue = &tree->queues[xmas_pick(tree)];
+                if (attempt == tree->nqueues) {
+                        pthread_mutex_lock(&queue->lock);
+                        break;
+                }
+        }
+
+        xmas_heap_push(tree, queue, elem);
+        pthread_mutex_unlock(&queue->lock);
+}
+
+bool XmasTree_pop(XmasTree_T tree, void **elem)
+{
+        Xmas_Queue_T *a, *b;
+        int attempt;
+        int i, j;
+
+        assert(tree != NULL);
+        assert(elem != NULL);
+
+        for (attempt = 0; attempt < tree->nqueues; attempt++) {
+                i = xmas_pick(tree);
+                j = xmas_pick(tree);
+                if (i == j)
+                        j = (i + 1) % tree->nqueues;
+                a = &tree->queues[i];
+                b = &tree->queues[j];
+
+                if (pthread_mutex_trylock(&a->lock) != 0)
+                        continue;
+                if (pthread_mutex_trylock(&b->lock) != 0) {
+                        pthread_mutex_unlock(&a->lock);
+                        continue;
+                }
+
+                /* make a the queue to pop from, if either has anything */
+                if (Vector_length(a->heap) == 0 ||
+                    (Vector_length(b->heap) > 0 &&
+                     tree->cmp(Vector_first(b->heap),
+                               Vector_first(a->heap), tree->cl) < 0)) {
+                        pthread_mutex_unlock(&a->lock);
+                        a = b;
+                } else {
+                        pthread_mutex_unlock(&b->lock);
+                }
+
+                if (Vector_length(a->heap) > 0) {
+                        *elem = xmas_heap_pop(tree, a);
+                        pthread_mutex_unlock(&a->lock);
+                        return true;
+                }
+                pthread_mutex_unlock(&a->lock);
+        }
+
+        for (i = 0; i < tree->nqueues; i++) {
+                a = &tree->queues[i];
+                pthread_mutex_lock(&a->lock);
+                if (Vector_length(a->heap) > 0) {
+                        *elem = xmas_heap_pop(tree, a);
+                        pthread_mutex_unlock(&a->lock);
+                        return true;
+                }
+                pthread_mutex_unlock(&a->lock);
+        }
+
+        return false;
+}
+
+int XmasTree_length(XmasTree_T tree)
+{
+        int length = 0;
+        int q;
+
+        assert(tree != NULL);
+
+        for (q = 0; q < tree->nqueues; q++) {
+                pthread_mutex_lock(&tree->queues[q].lock);
+                length += Vector_length(tree->queues[q].heap);
+                pthread_mutex_unlock(&tree->queues[q].lock);
+        }
+
+        return length;
+}
+
+/*-------------------------------------
+ * Helper/Private Definitions
+ -------------------------------------*/
+static int xmas_pick(XmasTree_T tree)
+{
+        uint32_t x = xmas_seed;
+
+        if (x == 0) //first use on this thread: seed from its TLS address
+                x = (uint32_t) ((uintptr_t) &xmas_seed >> 4) * 2654435761u
+                    | 1;
+
+        /* xorshift32 */
+        x ^= x << 13;
+        x ^= x >> 17;
+        x ^= x << 5;
+        xmas_seed = x;
+
+        return (int) (((uint64_t) x * (uint32_t) tree->nqueues) >> 32);
+}
+
+static void xmas_heap_push(XmasTree_T tree, Xmas_Queue_T *queue,
+                           void *elem)
+{
+        void **heap;
+        int i, parent;
+
+        Vector_append(queue->heap, elem);
+        heap = Vector_data(queue->heap);
+
+        for (i = Vector_length(queue->heap) - 1; i > 0; i = parent) {
+                parent = (i - 1) / 2;
+                if (tree->cmp(elem, heap[parent], tree->cl) >= 0)
+                        break;
+                heap[i] = heap[parent];
+        }
+        heap[i] = elem;
+}
+
+static void *xmas_heap_pop(XmasTree_T tree, Xmas_Queue_T *queue)
+{
+        void **heap = Vector_data(queue->heap);
+        void *min = heap[0];
+        void *elem;
+        int n, i, child;
+
+        elem = Vector_last(queue->heap);
+        Vector_removehi(queue->heap);
+        n = Vector_length(queue->heap);
+
+        for (i = 0; (child = 2 * i + 1) < n; i = child) {
+                if (child + 1 < n &&
+                    tree->cmp(heap[child + 1], heap[child], tree->cl) < 0)
+                        child++;
+                if (tree->cmp(heap[child], elem, tree->cl) >= 0)
+                        break;
+                heap[i] = heap[child];
+        }
+        if (n > 0)
+                heap[i] = elem;
+
+        return min;
+}
@@ -0,0 +1,242 @@
+/*
+ *      filename:       test_arena.c
+ *      author:         @keiferchiang
+ *      date:           18 Oct 2026
+ *      version:        0.0.1
+ *
+ *      description:    Unit tests for the Arena module
+ */
+
+#include <stdint.h>
+
+#include "arena.h"
+#include "vector.h"
+#include "dlinkedlist.h"
+
+/*-------------------------------------
+ * Function Prototypes
+ -------------------------------------*/
+void test_arena_alloc(Arena_T arena);
+void test_arena_rewind(Arena_T arena);
+void test_arena_reset(Arena_T arena);
+void test_arena_huge(void);
+void test_arena_thread(void);
+void test_arena_containers(Arena_T arena);
+
+/*-------------------------------------
+ * Main
+ -------------------------------------*/
+int main(int argc, char *argv[]) {
+        Arena_T arena;
+
+        (void) argc, (void) argv;
+
+        arena = Arena_new(1024, false);
+        assert(arena != NULL);
+
+        fprintf(stderr, "\n"); //formatting
+
+        //Unit Tests
+        test_arena_alloc(arena);
+        test_arena_rewind(arena);
+        test_arena_reset(arena);
+        test_arena_huge();
+        test_arena_thread();
+        test_arena_containers(arena);
+
+        //Cleanup
+        Arena_free(&arena);
+        assert(arena == NULL);
+
+        return 0;
+}
+
+/*-------------------------------------
+ * Function Definitions
+ -------------------------------------*/
+void test_arena_alloc(Arena_T arena)
+{
+        char *a, *b, *big;
+        long *l;
+        size_t align;
+
+        fprintf(stderr, ">>>>>>>>>>>>>>>>>>>> Testing Arena_alloc\n");
+
+        //Valid Cases
+        fprintf(stderr, "Valid Cases --------\n");
+        a = Arena_alloc(arena, 3, 1);
+        b = Arena_alloc(arena, 5, 1);
+        assert(b == a + 3);
+
+        for (align = 1; align <= 256; align *= 2) {
+                a = Arena_alloc(arena, 1, align);
+                assert((uintptr_t) a % align == 0);
+        }
+        fprintf(stderr, "alignments 1..256 honoured\n");
+
+        l = Arena_calloc(arena, 16 * sizeof(long), 0);
+        assert(l[0] == 0 && l[15] == 0);
+
+        //Edge Cases
+        fprintf(stderr, "Edge Cases ---------\n");
+        big = Arena_alloc(arena, 64 * 1024, 0); //larger than a chunk
+        memset(big, 0xab, 64 * 1024);
+        a = Arena_alloc(arena, 0, 0);
+        assert(a != NULL);
+        (void) a, (void) b, (void) l;
+        //Arena_alloc(arena, 8, 3); //expected assertion
+        //Arena_alloc(NULL, 8, 0); //expected assertion
+
+        fprintf(stderr, ">>>>>>>>>> Tests Passed.\n\n");
+}
+
+void test_arena_rewind(Arena_T arena)
+{
+        Arena_Mark_T mark;
+        char *a, *b;
+        int i;
+
+        fprintf(stderr, ">>>>>>>>>>>>>>>>>>>> Testing mark and rewind\n");
+
+        //Valid Cases
+        fprintf(stderr, "Valid Cases --------\n");
+        mark = Arena_mark(arena);
+        a = Arena_alloc(arena, 100, 1);
+        Arena_rewind(arena, mark);
+        b = Arena_alloc(arena, 100, 1);
+        assert(a == b);
+        fprintf(stderr, "same chunk rewind reuses memory\n");
+
+        mark = Arena_mark(arena);
+        for (i = 0; i < 100; i++)
+                Arena_alloc(arena, 512, 0);
+        Arena_rewind(arena, mark);
+        b = Arena_alloc(arena, 100, 1);
+        Arena_rewind(arena, mark);
+        a = Arena_alloc(arena, 100, 1);
+        assert(a == b);
+        fprintf(stderr, "multi chunk rewind restores position\n");
+
+        //Edge Cases
+        fprintf(stderr, "Edge Cases ---------\n");
+        Arena_rewind(arena, Arena_mark(arena)); //no-op
+        (void) a, (void) b;
+
+        fprintf(stderr, ">>>>>>>>>> Tests Passed.\n\n");
+}
+
+void test_arena_reset(Arena_T arena)
+{
+        char *first, *again;
+        int i;
+
+        fprintf(stderr, ">>>>>>>>>>>>>>>>>>>> Testing Arena_reset\n");
+
+        //Valid Cases
+        fprintf(stderr, "Valid Cases --------\n");
+        Arena_reset(arena);
+        first = Arena_alloc(arena, 512, 0);
+        for (i = 0; i < 100; i++)
+                Arena_alloc(arena, 512, 0);
+        Arena_reset(arena);
+        again = Arena_alloc(arena, 512, 0);
+        fprintf(stderr, "reused chunk after reset: %s\n",
+                again == first ? "yes" : "no");
+
+        //Edge Cases
+        fprintf(stderr, "Edge Cases ---------\n");
+        Arena_reset(arena);
+        Arena_reset(arena); //resetting an empty arena
+
+        fprintf(stderr, ">>>>>>>>>> Tests Passed.\n\n");
+}
+
+void test_arena_huge(void)
+{
+        Arena_T huge;
+        char *p;
+
+        fprintf(stderr, ">>>>>>>>>>>>>>>>>>>> Testing huge page arenas\n");
+
+        //Valid Cases
+        fprintf(stderr, "Valid Cases --------\n");
+        huge = Arena_new(0, true);
+        p = Arena_alloc(huge, 3 * 1024 * 1024, 64);
+        assert((uintptr_t) p % 64 == 0);
+#if defined(__linux__)
+        /* chunk starts on a huge page, just before its first object */
+        assert((uintptr_t) p % (2 * 1024 * 1024) < 4096);
+#endif
+        memset(p, 1, 3 * 1024 * 1024);
+        Arena_reset(huge);
+        p = Arena_alloc(huge, 16, 0);
+        p[0] = 1;
+
+        //Edge Cases
+        fprintf(stderr, "Edge Cases ---------\n");
+        //Arena_alloc(huge, SIZE_MAX, 0); //expected assertion
+        Arena_free(&huge);
+        assert(huge == NULL);
+
+        fprintf(stderr, ">>>>>>>>>> Tests Passed.\n\n");
+}
+
+void test_arena_thread(void)
+{
+        Arena_T arena;
+
+        fprintf(stderr, ">>>>>>>>>>>>>>>>>>>> Testing Arena_thread\n");
+
+        //Valid Cases
+        fprintf(stderr, "Valid Cases --------\n");
+        arena = Arena_thread();
+        assert(arena == Arena_thread());
+        Arena_alloc(arena, 64, 0);
+        Arena_thread_free();
+
+        //Edge Cases
+        fprintf(stderr, "Edge Cases ---------\n");
+        Arena_thread_free(); //freeing twice is harmless
+
+        fprintf(stderr, ">>>>>>>>>> Tests Passed.\n\n");
+}
+
+void test_arena_containers(Arena_T arena)
+{
+        Vector_T vec;
+        DLinkedList_T list;
+        int vals[100];
+        int i;
+
+        fprintf(stderr, ">>>>>>>>>>>>>>>>>>>> Testing arena containers\n");
+
+        //Valid Cases
+        fprintf(stderr, "Valid Cases --------\n");
+        vec = Vector_new_arena(0, arena);
+        list = DLinkedList_new_arena(4, arena);
+        for (i = 0; i < 100; i++) {
+                vals[i] = i;
+                Vector_append(vec, &vals[i]);
+                DLinkedList_append(list, &vals[i]);
+        }
+        assert(Vector_length(vec) == 100);
+        assert(DLinkedList_length(list) == 100);
+        for (i = 0; i < 100; i++) {
+                assert(*(int *) Vector_get(vec, i) == i);
+                assert(*(int *) DLinkedList_get(list, i) == i);
+        }
+        fprintf(stderr, "vec length: %d\n", Vector_length(vec));
+        fprintf(stderr, "list length: %d\n", DLinkedList_length(list));
+
+        Vector_free(&vec);
+        DLinkedList_free(&list);
+        assert(vec == NULL && list == NULL);
+
+        //Edge Cases
+        fprintf(stderr, "Edge Cases ---------\n");
+        list = DLinkedList_new_arena(0, arena);
+        Arena_reset(arena); //one reset instead of DLinkedList_free
+        //Vector_new_arena(0, NULL); //expected assertion
+
+        fprintf(stderr, ">>>>>>>>>> Tests Passed.\n\n");
+}
@@ -0,0 +1,248 @@
+/*
+ *      filename:       test_deque.c
+ *      author:         @keiferchiang
+ *      date:           18 Oct 2026
+ *      version:        0.0.1
+ *
+ *      description:    Unit tests for the Deque module
+ */
+
+#include <stdint.h>
+
+#include "deque.h"
+
+/*-------------------------------------
+ * Constants
+ -------------------------------------*/
+#define LENGTH          100003
+#define WIDTH           1000
+#define NOPS            200000
+
+/*-------------------------------------
+ * Function Prototypes
+ -------------------------------------*/
+void test_deque_append(void);
+void test_deque_remove(void);
+void test_deque_slot(void);
+void test_deque_random(void);
+
+unsigned next_rand(unsigned *state);
+
+/*-------------------------------------
+ * Main
+ -------------------------------------*/
+int main(int argc, char *argv[]) {
+        (void) argc, (void) argv;
+
+        fprintf(stderr, "\n"); //formatting
+
+        //Unit Tests
+        test_deque_append();
+        test_deque_remove();
+        test_deque_slot();
+        test_deque_random();
+
+        return 0;
+}
+
+/*-------------------------------------
+ * Function Definitions
+ -------------------------------------*/
+void test_deque_append(void)
+{
+        Deque_T deque;
+        Iter_T iter;
+        void *elem;
+        intptr_t expect;
+        bool ok;
+        int i;
+
+        fprintf(stderr, ">>>>>>>>>>>>>>>>>>>> Testing Deque_append\n");
+
+        //Valid Cases
+        fprintf(stderr, "Valid Cases --------\n");
+        deque = Deque_new(0);
+        for (i = 0; i < LENGTH; i++) {
+                Deque_append(deque, (void *) (intptr_t) i);
+                Deque_prepend(deque, (void *) (intptr_t) (-i - 1));
+        }
+        assert(Deque_length(deque) == 2 * LENGTH);
+        for (i = 0; i < 2 * LENGTH; i++)
+                assert((intptr_t) Deque_get(deque, i) == i - LENGTH);
+        assert((intptr_t) Deque_first(deque) == -LENGTH);
+        assert((intptr_t) Deque_last(deque) == LENGTH - 1);
+
+        expect = -LENGTH;
+        iter = Deque_iter(deque);
+        CDS_FOREACH(elem, iter) {
+                assert((intptr_t) elem == expect);
+                expect++;
+        }
+        assert(expect == LENGTH);
+        fprintf(stderr, "length: %d\n", Deque_length(deque));
+
+        //Edge Cases
+        fprintf(stderr, "Edge Cases ---------\n");
+        Deque_set(deque, NULL, LENGTH);
+        assert(Deque_get(deque, LENGTH) == NULL);
+        //Deque_get(deque, 2 * LENGTH); //expected assertion
+        Deque_free(&deque);
+        assert(deque == NULL);
+        deque = Deque_new(LENGTH);
+        assert(Deque_first(deque) == NULL && Deque_last(deque) == NULL);
+        iter = Deque_iter(deque);
+        ok = Iter_next(&iter, &elem);
+        assert(!ok);
+        (void) ok;
+        Deque_free(&deque);
+
+        fprintf(stderr, ">>>>>>>>>> Tests Passed.\n\n");
+}
+
+void test_deque_remove(void)
+{
+        Deque_T deque;
+        intptr_t sum = 0;
+        int i;
+
+        fprintf(stderr, ">>>>>>>>>>>>>>>>>>>> Testing Deque_remove\n");
+
+        //Valid Cases
+        fprintf(stderr, "Valid Cases --------\n");
+        deque = Deque_new(WIDTH);
+        for (i = 0; i < LENGTH; i++) { //sliding window
+                Deque_append(deque, (void *) (intptr_t) i);
+                sum += i;
+                if (Deque_length(deque) > WIDTH) {
+                        sum -= (intptr_t) Deque_first(deque);
+                        Deque_removelo(deque);
+                }
+                assert((intptr_t) Deque_first(deque) ==
+                       (i < WIDTH ? 0 : i - WIDTH + 1));
+        }
+        assert(Deque_length(deque) == WIDTH);
+        assert(sum == (intptr_t) WIDTH * (2 * LENGTH - WIDTH - 1) / 2);
+
+        for (i = 0; i < WIDTH / 2; i++)
+                Deque_removehi(deque);
+        assert((intptr_t) Deque_last(deque) == LENGTH - WIDTH / 2 - 1);
+        fprintf(stderr, "window sum: %ld\n", (long) sum);
+
+        //Edge Cases
+        fprintf(stderr, "Edge Cases ---------\n");
+        while (Deque_length(deque) > 0)
+                Deque_removehi(deque);
+        //Deque_removelo(deque); //expected assertion
+        Deque_prepend(deque, (void *) 1); //reusable once emptied
+        Deque_removelo(deque);
+        Deque_append(deque, (void *) 2);
+        assert((intptr_t) Deque_first(deque) == 2);
+        Deque_removelo(deque);
+        assert(Deque_length(deque) == 0);
+        Deque_free(&deque);
+
+        fprintf(stderr, ">>>>>>>>>> Tests Passed.\n\n");
+}
+
+void test_deque_slot(void)
+{
+        Deque_T deque;
+        void **slots[3];
+        int i;
+
+        fprintf(stderr, ">>>>>>>>>>>>>>>>>>>> Testing Deque_slot\n");
+
+        //Valid Cases
+        fprintf(stderr, "Valid Cases --------\n");
+        deque = Deque_new(0);
+        for (i = 0; i < 3; i++)
+                Deque_append(deque, (void *) (intptr_t) i);
+        for (i = 0; i < 3; i++)
+                slots[i] = Deque_slot(deque, i);
+
+        for (i = 0; i < LENGTH; i++) { //regrows the map many times
+                Deque_append(deque, NULL);
+                Deque_prepend(deque, NULL);
+        }
+        for (i = 0; i < 3; i++) {
+                assert(Deque_slot(deque, LENGTH + i) == slots[i]);
+                assert((intptr_t) *slots[i] == i);
+        }
+        *slots[1] = (void *) 42;
+        assert((intptr_t) Deque_get(deque, LENGTH + 1) == 42);
+
+        for (i = 0; i < LENGTH; i++) {
+                Deque_removelo(deque);
+                Deque_removehi(deque);
+        }
+        assert(Deque_length(deque) == 3);
+        assert(Deque_slot(deque, 0) == slots[0]);
+        fprintf(stderr, "slots stable across %d ops\n", 4 * LENGTH);
+
+        //Edge Cases
+        fprintf(stderr, "Edge Cases ---------\n");
+        //Deque_slot(deque, 3); //expected assertion
+        Deque_free(&deque);
+
+        fprintf(stderr, ">>>>>>>>>> Tests Passed.\n\n");
+}
+
+void test_deque_random(void)
+{
+        Deque_T deque;
+        intptr_t *model;
+        unsigned state = 97;
+        int lo = NOPS;
+        int hi = NOPS;
+        int i, op;
+
+        fprintf(stderr, ">>>>>>>>>>>>>>>>>>>> Testing Deque random ops\n");
+
+        //Valid Cases
+        fprintf(stderr, "Valid Cases --------\n");
+        deque = Deque_new(0);
+        model = malloc(2 * NOPS * sizeof(intptr_t));
+        assert(model != NULL);
+
+        for (i = 0; i < NOPS; i++) {
+                op = next_rand(&state) % 5; //grows on average
+                if (op == 0 || op == 4) {
+                        model[hi++] = i;
+                        Deque_append(deque, (void *) (intptr_t) i);
+                } else if (op == 1) {
+                        model[--lo] = i;
+                        Deque_prepend(deque, (void *) (intptr_t) i);
+                } else if (op == 2 && hi > lo) {
+                        hi--;
+                        Deque_removehi(deque);
+                } else if (hi > lo) {
+                        lo++;
+                        Deque_removelo(deque);
+                }
+                assert(Deque_length(deque) == hi - lo);
+                if (hi > lo) {
+                        assert((intptr_t) Deque_first(deque) == model[lo]);
+                        assert((intptr_t) Deque_last(deque) ==
+                               model[hi - 1]);
+                }
+        }
+        for (i = lo; i < hi; i++)
+                assert((intptr_t) Deque_get(deque, i - lo) == model[i]);
+        fprintf(stderr, "final length: %d\n", Deque_length(deque));
+
+        //Edge Cases
+        fprintf(stderr, "Edge Cases ---------\n");
+        while (Deque_length(deque) > 0) //drain across block boundaries
+                Deque_removelo(deque);
+        assert(Deque_first(deque) == NULL);
+        free(model);
+        Deque_free(&deque);
+
+        fprintf(stderr, ">>>>>>>>>> Tests Passed.\n\n");
+}
+
+unsigned next_rand(unsigned *state)
+{
+        *state = *state * 1103515245u + 12345u;
+        return (*state >> 1) & 0x7fffffff;
+}
@@ -7,6 +7,9 @@
  *      description:    Interface for the Vector module
  */
 
+#include <unistd.h>
+#include <stdint.h>
+
 #include "dlinkedlist.h"
 
 /*-------------------------------------
@@ -27,6 +30,12 @@ void test_list_lo(DLinkedList_T list);
 void test_list_hi(DLinkedList_T list);
 void test_list_remove(DLinkedList_T list);
 void test_list_pops(DLinkedList_T list);
+void test_list_clear(void);
+void test_list_spare(void);
+void test_list_writev(void);
+size_t record_length(void *elem, void *cl);
+void count_free(void *elem, void *cl);
+void count_free_batch(void **elems, int length, void *cl);
 
 /*-------------------------------------
  * Main
@@ -55,6 +64,9 @@ int main(int argc, char *argv[]) {
 	test_list_hi(list);
 	//test_list_remove(list);
 	//test_list_pops(list);
+	test_list_clear();
+	test_list_spare();
+	test_list_writev();
 
 	//Cleanup
 	free(test1);
@@ -352,3 +364,193 @@ void test_list_pops(DLinkedList_T list)
 	fprintf(stderr, ">>>>>>>>>> Tests Passed.\n\n");
 	free(test2);
 }
+
+void test_list_clear(void)
+{
+	DLinkedList_T list;
+	DLinkedList_T null_list = NULL;
+	Test_T test2;
+	int freed = 0;
+	int i;
+
+	fprintf(stderr, ">>>>>>>>>>>>>>>>>>>> Testing own & clear\n");
+
+	//Valid Cases
+	fprintf(stderr, "Valid Cases --------\n");
+	list = DLinkedList_new(16);
+	for (i = 0; i < 100; i++) {
+		test2 = malloc(sizeof(struct test));
+		assert(test2 != NULL);
+		DLinkedList_append(list, test2);
+	}
+	DLinkedList_clear(&list); //default destructor is free
+	assert(list == NULL);
+
+	list = DLinkedList_new(0);
+	DLinkedList_own(list, count_free, NULL, &freed);
+	for (i = 0; i < 100; i++)
+		DLinkedList_prepend(list, &freed);
+	DLinkedList_clear(&list);
+	fprintf(stderr, "freed one by one: %d\n", freed);
+	assert(freed == 100);
+
+	freed = 0;
+	list = DLinkedList_new(0);
+	DLinkedList_own(list, NULL, count_free_batch, &freed);
+	for (i = 0; i < 1000; i++)
+		DLinkedList_append(list, &freed);
+	DLinkedList_clear(&list);
+	fprintf(stderr, "freed in batches: %d\n", freed);
+	assert(freed == 1000);
+
+	//Edge Cases
+	(void) null_list;
+	fprintf(stderr, "Edge Cases ---------\n");
+	freed = 0;
+	list = DLinkedList_new(8); //spare nodes hold no elements
+	DLinkedList_own(list, count_free, NULL, &freed);
+	DLinkedList_append(list, &freed);
+	DLinkedList_clear(&list);
+	assert(freed == 1);
+	//DLinkedList_clear(&null_list); //expected assertion
+
+	fprintf(stderr, ">>>>>>>>>> Tests Passed.\n\n");
+}
+
+void test_list_spare(void)
+{
+	DLinkedList_T list;
+	int i;
+
+	fprintf(stderr, ">>>>>>>>>>>>>>>>>>>> Testing append & prepend"
+		" around spare nodes\n");
+
+	//Valid Cases
+	fprintf(stderr, "Valid Cases --------\n");
+	list = DLinkedList_new(4); //spare nodes all behind list_end
+	DLinkedList_append(list, (void *) (intptr_t) 2);
+	DLinkedList_prepend(list, (void *) (intptr_t) 1);
+	DLinkedList_prepend(list, (void *) (intptr_t) 0);
+	DLinkedList_append(list, (void *) (intptr_t) 3);
+	DLinkedList_append(list, (void *) (intptr_t) 4);
+	assert(DLinkedList_length(list) == 5);
+	for (i = 0; i < 5; i++)
+		assert((intptr_t) DLinkedList_get(list, i) == i);
+	DLinkedList_free(&list);
+
+	list = DLinkedList_new(4); //and in front of list_start
+	DLinkedList_prepend(list, (void *) (intptr_t) 3);
+	for (i = 4; i < 8; i++)
+		DLinkedList_append(list, (void *) (intptr_t) i);
+	for (i = 2; i >= 0; i--)
+		DLinkedList_prepend(list, (void *) (intptr_t) i);
+	assert(DLinkedList_length(list) == 8);
+	for (i = 0; i < 8; i++)
+		assert((intptr_t) DLinkedList_get(list, i) == i);
+	assert((intptr_t) DLinkedList_first(list) == 0);
+	assert((intptr_t) DLinkedList_last(list) == 7);
+	DLinkedList_free(&list);
+
+	//Edge Cases
+	fprintf(stderr, "Edge Cases ---------\n");
+	list = DLinkedList_new(0); //append into an empty list
+	DLinkedList_append(list, (void *) (intptr_t) 1);
+	assert(DLinkedList_length(list) == 1);
+	assert((intptr_t) DLinkedList_first(list) == 1);
+	assert((intptr_t) DLinkedList_last(list) == 1);
+	DLinkedList_prepend(list, (void *) (intptr_t) 0);
+	assert((intptr_t) DLinkedList_get(list, 0) == 0);
+	assert((intptr_t) DLinkedList_get(list, 1) == 1);
+	DLinkedList_free(&list);
+
+	list = DLinkedList_new(0); //prepend into an empty list
+	DLinkedList_prepend(list, (void *) (intptr_t) 1);
+	DLinkedList_append(list, (void *) (intptr_t) 2);
+	assert((intptr_t) DLinkedList_first(list) == 1);
+	assert((intptr_t) DLinkedList_last(list) == 2);
+	DLinkedList_free(&list);
+
+	fprintf(stderr, ">>>>>>>>>> Tests Passed.\n\n");
+}
+
+void test_list_writev(void)
+{
+	static char records[] = "abcdefghijklmnop";
+	static char tail[] = "qrst";
+	struct iovec iov[4];
+	char out[32];
+	size_t size = 4;
+	DLinkedList_T list;
+	ssize_t written;
+	int fds[2];
+	int index = 0;
+	int count;
+	int rc;
+	int i;
+
+	fprintf(stderr, ">>>>>>>>>>>>>>>>>>>> Testing DLinkedList_iovec & writev\n");
+
+	//Valid Cases
+	fprintf(stderr, "Valid Cases --------\n");
+	list = DLinkedList_new(0);
+	for (i = 0; i < 4; i++)
+		DLinkedList_append(list, records + 4 * i);
+	DLinkedList_append(list, tail);
+
+	count = DLinkedList_iovec(list, &index, iov, 4, record_length, &size);
+	fprintf(stderr, "5 buffers in %d iovecs\n", count);
+	assert(count == 2 && index == 5);
+	assert(iov[0].iov_base == records && iov[0].iov_len == 16);
+	assert(iov[1].iov_base == tail && iov[1].iov_len == 4);
+
+	index = 0;
+	count = DLinkedList_iovec(list, &index, iov, 1, record_length, &size);
+	assert(count == 1 && index == 4); //stops at a full iov
+	count = DLinkedList_iovec(list, &index, iov, 1, record_length, &size);
+	assert(count == 1 && index == 5);
+	count = DLinkedList_iovec(list, &index, iov, 1, record_length, &size);
+	assert(count == 0 && index == 5);
+
+	rc = pipe(fds);
+	assert(rc == 0);
+	written = DLinkedList_writev(list, fds[1], record_length, &size);
+	assert(written == 20);
+	written = read(fds[0], out, sizeof(out));
+	assert(written == 20);
+	assert(memcmp(out, "abcdefghijklmnopqrst", 20) == 0);
+	fprintf(stderr, "writev matches\n");
+
+	//Edge Cases
+	fprintf(stderr, "Edge Cases ---------\n");
+	size = 0; //empty buffers are skipped
+	index = 0;
+	count = DLinkedList_iovec(list, &index, iov, 4, record_length, &size);
+	assert(count == 0);
+	written = DLinkedList_writev(list, fds[1], record_length, &size);
+	assert(written == 0);
+	(void) rc, (void) written;
+	close(fds[0]);
+	close(fds[1]);
+	DLinkedList_free(&list);
+	//DLinkedList_iovec(list, &index, NULL, 4, record_length, &size); //expected assertion
+
+	fprintf(stderr, ">>>>>>>>>> Tests Passed.\n\n");
+}
+
+void count_free(void *elem, void *cl)
+{
+	(void) elem;
+	(*(int *) cl)++;
+}
+
+void count_free_batch(void **elems, int length, void *cl)
+{
+	(void) elems;
+	*(int *) cl += length;
+}
+
+size_t record_length(void *elem, void *cl)
+{
+	(void) elem;
+	return *(size_t *) cl;
+}
@@ -0,0 +1,442 @@
+/*
+ *      filename:       test_iter.c
+ *      author:         @keiferchiang
+ *      date:           18 Oct 2026
+ *      version:        0.0.1
+ *
+ *      description:    Unit tests for the Iter module and the
+ *                      Vector and DLinkedList iterators
+ */
+
+#include <stdint.h>
+
+#include "iter.h"
+#include "vector.h"
+#include "dlinkedlist.h"
+
+/*-------------------------------------
+ * Representation
+ -------------------------------------*/
+typedef struct test {
+        unsigned x;
+        int y;
+} *Test_T;
+
+/*-------------------------------------
+ * Function Prototypes
+ -------------------------------------*/
+void test_iter_vector(void);
+void test_iter_dlist(void);
+void test_iter_func(void);
+void test_iter_algorithms(void);
+void test_iter_adapters(void);
+void test_iter_pipeline(void);
+
+bool count_up(Iter_T *iter, void **elem);
+bool is_odd(void *elem, void *cl);
+void add_x(void *elem, void *cl);
+bool is_even(void *elem, void *cl);
+void *triple(void *elem, void *cl);
+void *add(void *a, void *b, void *cl);
+void *sum(void *accum, void *elem, void *cl);
+
+/*-------------------------------------
+ * Main
+ -------------------------------------*/
+int main(int argc, char *argv[]) {
+        (void) argc, (void) argv;
+
+        fprintf(stderr, "\n"); //formatting
+
+        //Unit Tests
+        test_iter_vector();
+        test_iter_dlist();
+        test_iter_func();
+        test_iter_algorithms();
+        test_iter_adapters();
+        test_iter_pipeline();
+
+        return 0;
+}
+
+/*-------------------------------------
+ * Function Definitions
+ -------------------------------------*/
+void test_iter_vector(void)
+{
+        struct test tests[100];
+        Vector_T vec;
+        Iter_T it;
+        Test_T test1;
+        void *elem;
+        bool ok;
+        int i;
+
+        fprintf(stderr, ">>>>>>>>>>>>>>>>>>>> Testing Vector_iter\n");
+
+        //Valid Cases
+        fprintf(stderr, "Valid Cases --------\n");
+        vec = Vector_new(0);
+        for (i = 0; i < 100; i++) {
+                tests[i].x = i;
+                tests[i].y = -i;
+                Vector_append(vec, &tests[i]);
+        }
+
+        i = 0;
+        it = Vector_iter(vec);
+        CDS_FOREACH(test1, it) {
+                assert(test1 == &tests[i]);
+                assert(test1->y == -i);
+                i++;
+        }
+        assert(i == 100);
+        ok = Iter_next(&it, &elem); //stays exhausted
+        assert(!ok);
+        fprintf(stderr, "visited %d elements in order\n", i);
+
+        it = Vector_iter(vec);
+        ok = Iter_peek(&it, &elem);
+        assert(ok && elem == &tests[0]);
+        ok = Iter_peek(&it, &elem);
+        assert(ok && elem == &tests[0]);
+        ok = Iter_next(&it, &elem);
+        assert(ok && elem == &tests[0]);
+        ok = Iter_peek(&it, &elem);
+        assert(ok && elem == &tests[1]);
+
+        //Edge Cases
+        fprintf(stderr, "Edge Cases ---------\n");
+        Vector_free(&vec);
+        vec = Vector_new(0);
+        it = Vector_iter(vec);
+        ok = Iter_peek(&it, &elem);
+        assert(!ok);
+        ok = Iter_next(&it, &elem);
+        assert(!ok);
+        (void) test1, (void) ok;
+        Vector_free(&vec);
+        //it = Vector_iter(NULL); //expected assertion
+
+        fprintf(stderr, ">>>>>>>>>> Tests Passed.\n\n");
+}
+
+void test_iter_dlist(void)
+{
+        struct test tests[100];
+        DLinkedList_T list;
+        Iter_T it;
+        Test_T test1;
+        void *elem;
+        bool ok;
+        int i;
+
+        fprintf(stderr, ">>>>>>>>>>>>>>>>>>>> Testing DLinkedList_iter\n");
+
+        //Valid Cases
+        fprintf(stderr, "Valid Cases --------\n");
+        list = DLinkedList_new(200); //spare nodes past list_end
+        for (i = 0; i < 100; i++) {
+                tests[i].x = i;
+                tests[i].y = -i;
+        }
+        for (i = 50; i < 100; i++)
+                DLinkedList_append(list, &tests[i]);
+        for (i = 49; i >= 0; i--)
+                DLinkedList_prepend(list, &tests[i]);
+
+        i = 0;
+        it = DLinkedList_iter(list);
+        CDS_FOREACH(test1, it) {
+                assert(test1 == &tests[i]);
+                i++;
+        }
+        assert(i == 100);
+        fprintf(stderr, "visited %d elements in order\n", i);
+
+        it = DLinkedList_iter(list);
+        ok = Iter_peek(&it, &elem);
+        assert(ok && elem == &tests[0]);
+        ok = Iter_next(&it, &elem);
+        assert(ok && elem == &tests[0]);
+        ok = Iter_next(&it, &elem);
+        assert(ok && elem == &tests[1]);
+
+        //Edge Cases
+        fprintf(stderr, "Edge Cases ---------\n");
+        DLinkedList_free(&list);
+        list = DLinkedList_new(0);
+        it = DLinkedList_iter(list);
+        ok = Iter_next(&it, &elem);
+        assert(!ok);
+        (void) test1, (void) ok;
+        DLinkedList_free(&list);
+
+        fprintf(stderr, ">>>>>>>>>> Tests Passed.\n\n");
+}
+
+void test_iter_func(void)
+{
+        int counter[2] = { 0, 5 }; //next value, limit
+        Iter_T it;
+        void *elem;
+        bool ok;
+        int i;
+
+        fprintf(stderr, ">>>>>>>>>>>>>>>>>>>> Testing Iter_func\n");
+
+        //Valid Cases
+        fprintf(stderr, "Valid Cases --------\n");
+        it = Iter_func(count_up, counter);
+        ok = Iter_peek(&it, &elem);
+        assert(ok && (intptr_t) elem == 0);
+        for (i = 0; Iter_next(&it, &elem); i++)
+                assert((intptr_t) elem == i);
+        assert(i == 5);
+        ok = Iter_peek(&it, &elem);
+        assert(!ok);
+        fprintf(stderr, "generated %d elements\n", i);
+
+        //Edge Cases
+        fprintf(stderr, "Edge Cases ---------\n");
+        counter[0] = counter[1] = 0;
+        it = Iter_func(count_up, counter);
+        ok = Iter_next(&it, &elem);
+        assert(!ok);
+        (void) ok;
+        //it = Iter_func(NULL, NULL); //expected assertion
+
+        fprintf(stderr, ">>>>>>>>>> Tests Passed.\n\n");
+}
+
+void test_iter_algorithms(void)
+{
+        struct test tests[10];
+        DLinkedList_T list;
+        Iter_T it;
+        void *elem;
+        unsigned sum = 0;
+        bool ok;
+        int i;
+
+        fprintf(stderr, ">>>>>>>>>>>>>>>>>>>> Testing Iter_find & apply\n");
+
+        //Valid Cases
+        fprintf(stderr, "Valid Cases --------\n");
+        list = DLinkedList_new(0);
+        for (i = 0; i < 10; i++) {
+                tests[i].x = i;
+                DLinkedList_append(list, &tests[i]);
+        }
+
+        it = DLinkedList_iter(list);
+        ok = Iter_find(&it, is_odd, NULL, &elem);
+        assert(ok && elem == &tests[1]);
+        ok = Iter_find(&it, is_odd, NULL, &elem);
+        assert(ok && elem == &tests[3]);
+
+        Iter_apply(&it, add_x, &sum); //rest of the list: 4..9
+        fprintf(stderr, "sum after second match: %u\n", sum);
+        assert(sum == 39);
+
+        //Edge Cases
+        fprintf(stderr, "Edge Cases ---------\n");
+        ok = Iter_find(&it, is_odd, NULL, &elem);
+        assert(!ok);
+        it = Iter_array(NULL, 0);
+        ok = Iter_find(&it, is_odd, NULL, NULL);
+        assert(!ok);
+        (void) ok;
+        DLinkedList_free(&list);
+
+        fprintf(stderr, ">>>>>>>>>> Tests Passed.\n\n");
+}
+
+void test_iter_adapters(void)
+{
+        Vector_T vec, out;
+        DLinkedList_T list;
+        Iter_T a, b, it;
+        void *elem;
+        long count;
+        bool ok;
+        int i;
+
+        fprintf(stderr, ">>>>>>>>>>>>>>>>>>>> Testing Iter adapters\n");
+
+        //Valid Cases
+        fprintf(stderr, "Valid Cases --------\n");
+        vec = Vector_new(0);
+        list = DLinkedList_new(0);
+        for (i = 0; i < 10; i++) {
+                Vector_append(vec, (void *) (intptr_t) i);
+                DLinkedList_append(list, (void *) (intptr_t) (100 * i));
+        }
+
+        a = Vector_iter(vec);
+        it = Iter_map(&a, triple, NULL);
+        for (i = 0; Iter_next(&it, &elem); i++)
+                assert((intptr_t) elem == 3 * i);
+        assert(i == 10);
+
+        a = Vector_iter(vec);
+        it = Iter_filter(&a, is_even, NULL);
+        ok = Iter_peek(&it, &elem);
+        assert(ok && (intptr_t) elem == 0);
+        count = Iter_count(&it);
+        assert(count == 5);
+
+        a = Vector_iter(vec);
+        it = Iter_take(&a, 3);
+        count = Iter_count(&it);
+        assert(count == 3);
+        ok = Iter_next(&a, &elem); //not overrun
+        assert(ok && (intptr_t) elem == 3);
+
+        a = Vector_iter(vec);
+        b = DLinkedList_iter(list);
+        it = Iter_zip(&a, &b, add, NULL);
+        for (i = 0; Iter_next(&it, &elem); i++)
+                assert((intptr_t) elem == 101 * i);
+        assert(i == 10);
+
+        a = Vector_iter(vec);
+        b = DLinkedList_iter(list);
+        it = Iter_chain(&a, &b);
+        out = Vector_collect(&it);
+        assert(Vector_length(out) == 20);
+        assert((intptr_t) Vector_get(out, 9) == 9);
+        assert((intptr_t) Vector_get(out, 10) == 0);
+        assert((intptr_t) Vector_get(out, 19) == 900);
+        fprintf(stderr, "map, filter, take, zip and chain match\n");
+        Vector_free(&out);
+
+        //Edge Cases
+        fprintf(stderr, "Edge Cases ---------\n");
+        a = Vector_iter(vec);
+        b = Iter_array(NULL, 0);
+        it = Iter_zip(&a, &b, add, NULL);
+        ok = Iter_next(&it, &elem);
+        assert(!ok);
+        count = Iter_count(&a); //zip did not consume a
+        assert(count == 10);
+        a = Vector_iter(vec);
+        it = Iter_take(&a, 0);
+        ok = Iter_next(&it, &elem);
+        assert(!ok);
+        b = Iter_array(NULL, 0);
+        it = Iter_chain(&b, &b);
+        count = Iter_count(&it);
+        assert(count == 0);
+        (void) count, (void) ok;
+        //it = Iter_take(&a, -1); //expected assertion
+
+        Vector_free(&vec);
+        DLinkedList_free(&list);
+
+        fprintf(stderr, ">>>>>>>>>> Tests Passed.\n\n");
+}
+
+void test_iter_pipeline(void)
+{
+        Vector_T vec, out;
+        Iter_T src, evens, tripled, first;
+        intptr_t total;
+        int i;
+
+        fprintf(stderr, ">>>>>>>>>>>>>>>>>>>> Testing Iter pipelines\n");
+
+        //Valid Cases
+        fprintf(stderr, "Valid Cases --------\n");
+        vec = Vector_new(0);
+        for (i = 0; i < 100000; i++)
+                Vector_append(vec, (void *) (intptr_t) i);
+
+        src = Vector_iter(vec);
+        evens = Iter_filter(&src, is_even, NULL);
+        tripled = Iter_map(&evens, triple, NULL);
+        first = Iter_take(&tripled, 1000);
+        out = Vector_collect(&first);
+        assert(Vector_length(out) == 1000);
+        for (i = 0; i < 1000; i++)
+                assert((intptr_t) Vector_get(out, i) == 6 * i);
+        fprintf(stderr, "collected %d elements\n", Vector_length(out));
+
+        src = Vector_iter(out);
+        total = (intptr_t) Iter_reduce(&src, (void *) 0, sum, NULL);
+        fprintf(stderr, "reduced to %ld\n", (long) total);
+        assert(total == 6 * (999 * 1000 / 2));
+        Vector_free(&out);
+
+        src = Vector_iter(vec);
+        out = Vector_collect(&src);
+        assert(Vector_length(out) == 100000);
+        assert(Vector_get(out, 99999) == Vector_get(vec, 99999));
+
+        //Edge Cases
+        fprintf(stderr, "Edge Cases ---------\n");
+        src = Vector_iter(vec);
+        total = (intptr_t) Iter_reduce(&src, NULL, sum, NULL);
+        assert(total != 0);
+        total = (intptr_t) Iter_reduce(&src, NULL, sum, NULL); //drained
+        assert(total == 0);
+        Vector_free(&out);
+        out = Vector_collect(&src);
+        assert(Vector_length(out) == 0);
+
+        Vector_free(&out);
+        Vector_free(&vec);
+
+        fprintf(stderr, ">>>>>>>>>> Tests Passed.\n\n");
+}
+
+/*
+ * Produces counter[0], counter[0] + 1, ... up to counter[1], where
+ * counter is the iterator's state
+ */
+bool count_up(Iter_T *iter, void **elem)
+{
+        int *counter = iter->state;
+
+        if (counter[0] >= counter[1])
+                return false;
+
+        *elem = (void *) (intptr_t) counter[0]++;
+
+        return true;
+}
+
+bool is_odd(void *elem, void *cl)
+{
+        (void) cl;
+        return ((Test_T) elem)->x % 2 == 1;
+}
+
+void add_x(void *elem, void *cl)
+{
+        *(unsigned *) cl += ((Test_T) elem)->x;
+}
+
+bool is_even(void *elem, void *cl)
+{
+        (void) cl;
+        return (intptr_t) elem % 2 == 0;
+}
+
+void *triple(void *elem, void *cl)
+{
+        (void) cl;
+        return (void *) ((intptr_t) elem * 3);
+}
+
+void *add(void *a, void *b, void *cl)
+{
+        (void) cl;
+        return (void *) ((intptr_t) a + (intptr_t) b);
+}
+
+void *sum(void *accum, void *elem, void *cl)
+{
+        (void) cl;
+        return (void *) ((intptr_t) accum + (intptr_t) elem);
+}
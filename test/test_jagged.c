@@ -0,0 +1,180 @@
+/*
+ *      filename:       test_jagged.c
+ *      author:         @keiferchiang
+ *      date:           18 Oct 2026
+ *      version:        0.0.1
+ *
+ *      description:    Unit tests for the Jagged module
+ */
+
+#include "jagged.h"
+
+/*-------------------------------------
+ * Constants
+ -------------------------------------*/
+#define ROWS            100003
+
+/*-------------------------------------
+ * Function Prototypes
+ -------------------------------------*/
+void test_jagged_push(void);
+void test_jagged_append_row(void);
+void test_jagged_freeze(void);
+
+/*-------------------------------------
+ * Main
+ -------------------------------------*/
+int main(int argc, char *argv[]) {
+        (void) argc, (void) argv;
+
+        fprintf(stderr, "\n"); //formatting
+
+        //Unit Tests
+        test_jagged_push();
+        test_jagged_append_row();
+        test_jagged_freeze();
+
+        return 0;
+}
+
+/*-------------------------------------
+ * Function Definitions
+ -------------------------------------*/
+void test_jagged_push(void)
+{
+        Jagged_T jag;
+        void **elems;
+        int64_t total = 0;
+        int length;
+        int row;
+        int i, j;
+
+        fprintf(stderr, ">>>>>>>>>>>>>>>>>>>> Testing Jagged_push\n");
+
+        //Valid Cases
+        fprintf(stderr, "Valid Cases --------\n");
+        jag = Jagged_new(0, 0);
+        for (i = 0; i < ROWS; i++) {
+                row = Jagged_add_row(jag);
+                assert(row == i);
+                for (j = 0; j < i % 7; j++)
+                        Jagged_push(jag, Vector_int(i + j));
+                total += i % 7;
+        }
+        assert(Jagged_rows(jag) == ROWS);
+        assert(Jagged_length(jag) == total);
+
+        for (i = 0; i < ROWS; i++) {
+                elems = Jagged_row(jag, i, &length);
+                assert(length == i % 7);
+                assert(Jagged_row_length(jag, i) == length);
+                for (j = 0; j < length; j++) {
+                        assert(Vector_toint(elems[j]) == i + j);
+                        assert(Jagged_get(jag, i, j) == elems[j]);
+                }
+        }
+        fprintf(stderr, "rows: %d, values: %ld\n", Jagged_rows(jag),
+                (long) Jagged_length(jag));
+
+        //Edge Cases
+        fprintf(stderr, "Edge Cases ---------\n");
+        assert(Jagged_row_length(jag, 0) == 0); //empty rows
+        assert(Jagged_row_length(jag, 7) == 0);
+        Jagged_row(jag, 0, NULL);
+        Jagged_set(jag, Vector_int(-1), 1, 0);
+        assert(Vector_toint(Jagged_get(jag, 1, 0)) == -1);
+        //Jagged_get(jag, 0, 0); //expected assertion
+        //Jagged_row(jag, ROWS, NULL); //expected assertion
+        Jagged_free(&jag);
+        assert(jag == NULL);
+        jag = Jagged_new(0, 0);
+        assert(Jagged_rows(jag) == 0 && Jagged_length(jag) == 0);
+        //Jagged_push(jag, NULL); //expected assertion
+        (void) elems, (void) row;
+        Jagged_free(&jag);
+
+        fprintf(stderr, ">>>>>>>>>> Tests Passed.\n\n");
+}
+
+void test_jagged_append_row(void)
+{
+        Jagged_T jag;
+        Vector_T vec;
+        int length;
+        int row;
+        int i, j;
+
+        fprintf(stderr, ">>>>>>>>>>>>>>>>>>>> Testing Jagged_append_row\n");
+
+        //Valid Cases
+        fprintf(stderr, "Valid Cases --------\n");
+        jag = Jagged_new(ROWS, 0);
+        vec = Vector_new(0);
+        for (i = 0; i < ROWS; i++) {
+                Vector_resize(vec, 0);
+                for (j = 0; j < i % 13; j++)
+                        Vector_append(vec, Vector_int(j * i));
+                row = Jagged_append_row(jag, vec);
+                assert(row == i);
+        }
+        for (i = 0; i < ROWS; i++) {
+                length = Jagged_row_length(jag, i);
+                assert(length == i % 13);
+                for (j = 0; j < length; j++)
+                        assert(Vector_toint(Jagged_get(jag, i, j)) == j * i);
+        }
+        fprintf(stderr, "values: %ld\n", (long) Jagged_length(jag));
+
+        //Edge Cases
+        fprintf(stderr, "Edge Cases ---------\n");
+        Jagged_add_row(jag); //append_row and push mix
+        Jagged_push(jag, Vector_int(1));
+        Vector_resize(vec, 0);
+        Jagged_append_row(jag, vec);
+        Jagged_push(jag, Vector_int(2)); //goes to the empty row
+        assert(Jagged_row_length(jag, ROWS) == 1);
+        assert(Vector_toint(Jagged_get(jag, ROWS + 1, 0)) == 2);
+        (void) row;
+        Vector_free(&vec);
+        Jagged_free(&jag);
+
+        fprintf(stderr, ">>>>>>>>>> Tests Passed.\n\n");
+}
+
+void test_jagged_freeze(void)
+{
+        Jagged_T jag;
+        int i, j;
+
+        fprintf(stderr, ">>>>>>>>>>>>>>>>>>>> Testing Jagged_freeze\n");
+
+        //Valid Cases
+        fprintf(stderr, "Valid Cases --------\n");
+        jag = Jagged_new(0, 0);
+        for (i = 0; i < ROWS; i++) {
+                Jagged_add_row(jag);
+                for (j = 0; j < i % 3; j++)
+                        Jagged_push(jag, Vector_int(i));
+        }
+        Jagged_freeze(jag);
+        assert(Jagged_rows(jag) == ROWS);
+        assert(Jagged_length(jag) == ROWS - 1); //0 + 1 + 2 per 3 rows
+        for (i = 0; i < ROWS; i++)
+                for (j = 0; j < i % 3; j++)
+                        assert(Vector_toint(Jagged_get(jag, i, j)) == i);
+        Jagged_set(jag, Vector_int(0), 2, 1); //values stay writable
+        assert(Vector_toint(Jagged_get(jag, 2, 1)) == 0);
+        fprintf(stderr, "frozen rows: %d\n", Jagged_rows(jag));
+
+        //Edge Cases
+        fprintf(stderr, "Edge Cases ---------\n");
+        Jagged_freeze(jag); //already frozen
+        //Jagged_add_row(jag); //expected assertion
+        Jagged_free(&jag);
+        jag = Jagged_new(0, 0);
+        Jagged_freeze(jag);
+        assert(Jagged_rows(jag) == 0 && Jagged_length(jag) == 0);
+        Jagged_free(&jag);
+
+        fprintf(stderr, ">>>>>>>>>> Tests Passed.\n\n");
+}
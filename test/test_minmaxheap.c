@@ -0,0 +1,205 @@
+/*
+ *      filename:       test_minmaxheap.c
+ *      author:         @keiferchiang
+ *      date:           18 Oct 2026
+ *      version:        0.0.1
+ *
+ *      description:    Unit tests for the MinMaxHeap module
+ */
+
+#include <stdint.h>
+
+#include "minmaxheap.h"
+
+/*-------------------------------------
+ * Constants
+ -------------------------------------*/
+#define LENGTH          100003
+#define BEST            100
+
+/*-------------------------------------
+ * Function Prototypes
+ -------------------------------------*/
+void test_minmaxheap_push(void);
+void test_minmaxheap_pop(void);
+void test_minmaxheap_bounded(void);
+
+int cmp_int(void *a, void *b, void *cl);
+unsigned next_rand(unsigned *state);
+
+/*-------------------------------------
+ * Main
+ -------------------------------------*/
+int main(int argc, char *argv[]) {
+        (void) argc, (void) argv;
+
+        fprintf(stderr, "\n"); //formatting
+
+        //Unit Tests
+        test_minmaxheap_push();
+        test_minmaxheap_pop();
+        test_minmaxheap_bounded();
+
+        return 0;
+}
+
+/*-------------------------------------
+ * Function Definitions
+ -------------------------------------*/
+void test_minmaxheap_push(void)
+{
+        MinMaxHeap_T heap;
+        Iter_T iter;
+        void *elem;
+        unsigned state = 7;
+        intptr_t lo = INTPTR_MAX;
+        intptr_t hi = INTPTR_MIN;
+        intptr_t value;
+        int count = 0;
+        int i;
+
+        fprintf(stderr, ">>>>>>>>>>>>>>>>>>>> Testing MinMaxHeap_push\n");
+
+        //Valid Cases
+        fprintf(stderr, "Valid Cases --------\n");
+        heap = MinMaxHeap_new(0, cmp_int, NULL);
+        for (i = 0; i < LENGTH; i++) {
+                value = next_rand(&state) % 1000000;
+                lo = value < lo ? value : lo;
+                hi = value > hi ? value : hi;
+                MinMaxHeap_push(heap, Vector_int(value));
+                assert(Vector_toint(MinMaxHeap_min(heap)) == lo);
+                assert(Vector_toint(MinMaxHeap_max(heap)) == hi);
+        }
+        assert(MinMaxHeap_length(heap) == LENGTH);
+
+        iter = MinMaxHeap_iter(heap);
+        CDS_FOREACH(elem, iter) {
+                assert(Vector_toint(elem) >= lo && Vector_toint(elem) <= hi);
+                count++;
+        }
+        assert(count == LENGTH);
+        fprintf(stderr, "min: %ld, max: %ld\n", (long) lo, (long) hi);
+
+        //Edge Cases
+        fprintf(stderr, "Edge Cases ---------\n");
+        MinMaxHeap_free(&heap);
+        assert(heap == NULL);
+        heap = MinMaxHeap_new(0, cmp_int, NULL);
+        //MinMaxHeap_min(heap); //expected assertion
+        MinMaxHeap_push(heap, Vector_int(5));
+        assert(MinMaxHeap_min(heap) == MinMaxHeap_max(heap));
+        MinMaxHeap_push(heap, Vector_int(5)); //duplicates
+        MinMaxHeap_push(heap, Vector_int(5));
+        assert(Vector_toint(MinMaxHeap_max(heap)) == 5);
+        (void) elem;
+        MinMaxHeap_free(&heap);
+        //MinMaxHeap_new(0, NULL, NULL); //expected assertion
+
+        fprintf(stderr, ">>>>>>>>>> Tests Passed.\n\n");
+}
+
+void test_minmaxheap_pop(void)
+{
+        MinMaxHeap_T heap;
+        unsigned state = 11;
+        intptr_t lo = -1;
+        intptr_t hi = LENGTH;
+        intptr_t value;
+        int i;
+
+        fprintf(stderr, ">>>>>>>>>>>>>>>>>>>> Testing MinMaxHeap_pop\n");
+
+        //Valid Cases
+        fprintf(stderr, "Valid Cases --------\n");
+        heap = MinMaxHeap_new(LENGTH, cmp_int, NULL);
+        for (i = 0; i < LENGTH; i++) //a permutation of [0, LENGTH)
+                MinMaxHeap_push(heap, Vector_int((i * 7919L) % LENGTH));
+
+        /* pops from either end at random meet in the middle */
+        for (i = 0; i < LENGTH; i++) {
+                if (next_rand(&state) % 2) {
+                        value = Vector_toint(MinMaxHeap_pop_min(heap));
+                        lo++;
+                        assert(value == lo);
+                } else {
+                        value = Vector_toint(MinMaxHeap_pop_max(heap));
+                        hi--;
+                        assert(value == hi);
+                }
+                assert(MinMaxHeap_length(heap) == LENGTH - 1 - i);
+        }
+        assert(lo + 1 == hi);
+        fprintf(stderr, "met at: %ld\n", (long) hi);
+
+        //Edge Cases
+        fprintf(stderr, "Edge Cases ---------\n");
+        MinMaxHeap_push(heap, Vector_int(2));
+        MinMaxHeap_push(heap, Vector_int(1));
+        value = Vector_toint(MinMaxHeap_pop_max(heap));
+        assert(value == 2);
+        value = Vector_toint(MinMaxHeap_pop_max(heap));
+        assert(value == 1);
+        assert(MinMaxHeap_length(heap) == 0);
+        (void) value;
+        //MinMaxHeap_pop_min(heap); //expected assertion
+        MinMaxHeap_free(&heap);
+
+        fprintf(stderr, ">>>>>>>>>> Tests Passed.\n\n");
+}
+
+void test_minmaxheap_bounded(void)
+{
+        MinMaxHeap_T heap;
+        intptr_t prev;
+        intptr_t value;
+        void *elem;
+        int i;
+
+        fprintf(stderr, ">>>>>>>>>>>>>>>>>>>> Testing MinMaxHeap bounded\n");
+
+        //Valid Cases
+        fprintf(stderr, "Valid Cases --------\n");
+        heap = MinMaxHeap_new(BEST + 1, cmp_int, NULL);
+        for (i = 0; i < LENGTH; i++) { //keep best BEST, evict worst
+                MinMaxHeap_push(heap, Vector_int((i * 7919L) % LENGTH));
+                if (MinMaxHeap_length(heap) > BEST)
+                        MinMaxHeap_pop_min(heap);
+        }
+        assert(MinMaxHeap_length(heap) == BEST);
+        assert(Vector_toint(MinMaxHeap_min(heap)) == LENGTH - BEST);
+
+        prev = LENGTH;
+        while (MinMaxHeap_length(heap) > 0) {
+                value = Vector_toint(MinMaxHeap_pop_max(heap));
+                assert(value == prev - 1);
+                prev = value;
+        }
+        fprintf(stderr, "kept: %d..%d\n", LENGTH - BEST, LENGTH - 1);
+
+        //Edge Cases
+        fprintf(stderr, "Edge Cases ---------\n");
+        MinMaxHeap_push(heap, Vector_int(-1));
+        elem = MinMaxHeap_pop_min(heap);
+        assert(elem == Vector_int(-1));
+        (void) elem, (void) prev;
+        MinMaxHeap_free(&heap);
+
+        fprintf(stderr, ">>>>>>>>>> Tests Passed.\n\n");
+}
+
+int cmp_int(void *a, void *b, void *cl)
+{
+        intptr_t x = Vector_toint(a);
+        intptr_t y = Vector_toint(b);
+
+        (void) cl;
+
+        return (x > y) - (x < y);
+}
+
+unsigned next_rand(unsigned *state)
+{
+        *state = *state * 1103515245u + 12345u;
+        return (*state >> 1) & 0x7fffffff;
+}
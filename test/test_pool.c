@@ -0,0 +1,204 @@
+/*
+ *      filename:       test_pool.c
+ *      author:         @keiferchiang
+ *      date:           18 Oct 2026
+ *      version:        0.0.1
+ *
+ *      description:    Unit tests for the Pool module
+ */
+
+#include <stdint.h>
+#include <pthread.h>
+
+#include "pool.h"
+#include "dlinkedlist.h"
+
+/*-------------------------------------
+ * Constants
+ -------------------------------------*/
+#define NTHREADS        4
+#define NOBJS           10000
+
+/*-------------------------------------
+ * Function Prototypes
+ -------------------------------------*/
+void test_pool_alloc(void);
+void test_pool_reuse(void);
+void test_pool_threads(void);
+void test_pool_dlist(void);
+void *producer(void *arg);
+void *consumer(void *arg);
+
+/*-------------------------------------
+ * Main
+ -------------------------------------*/
+int main(int argc, char *argv[]) {
+        (void) argc, (void) argv;
+
+        fprintf(stderr, "\n"); //formatting
+
+        //Unit Tests
+        test_pool_alloc();
+        test_pool_reuse();
+        test_pool_threads();
+        test_pool_dlist();
+
+        //Cleanup
+        Pool_flush();
+        Pool_trim();
+
+        return 0;
+}
+
+/*-------------------------------------
+ * Function Definitions
+ -------------------------------------*/
+void test_pool_alloc(void)
+{
+        char *small, *large, *zero;
+        size_t size;
+
+        fprintf(stderr, ">>>>>>>>>>>>>>>>>>>> Testing Pool_alloc\n");
+
+        //Valid Cases
+        fprintf(stderr, "Valid Cases --------\n");
+        for (size = 1; size <= POOL_MAX_SIZE; size++) {
+                small = Pool_alloc(size);
+                assert((uintptr_t) small % 16 == 0);
+                memset(small, 0x5a, size);
+                Pool_free(small, size);
+        }
+        fprintf(stderr, "sizes 1..%d served\n", POOL_MAX_SIZE);
+
+        //Edge Cases
+        fprintf(stderr, "Edge Cases ---------\n");
+        large = Pool_alloc(POOL_MAX_SIZE + 1); //falls back to malloc
+        memset(large, 0, POOL_MAX_SIZE + 1);
+        Pool_free(large, POOL_MAX_SIZE + 1);
+        zero = Pool_alloc(0);
+        Pool_free(zero, 0);
+        //Pool_free(NULL, 8); //expected assertion
+
+        fprintf(stderr, ">>>>>>>>>> Tests Passed.\n\n");
+}
+
+void test_pool_reuse(void)
+{
+        void *objs[1000];
+        void *first, *again;
+        int i;
+
+        fprintf(stderr, ">>>>>>>>>>>>>>>>>>>> Testing Pool reuse\n");
+
+        //Valid Cases
+        fprintf(stderr, "Valid Cases --------\n");
+        first = Pool_alloc(24);
+        Pool_free(first, 24);
+        again = Pool_alloc(24);
+        assert(again == first); //LIFO per thread
+        Pool_free(again, 24);
+
+        for (i = 0; i < 1000; i++)
+                objs[i] = Pool_alloc(24);
+        for (i = 0; i < 1000; i++)
+                Pool_free(objs[i], 24);
+        fprintf(stderr, "1000 objects cycled through magazines\n");
+
+        Pool_flush();
+        for (i = 0; i < 1000; i++)
+                objs[i] = Pool_alloc(24); //served from the depot
+        for (i = 0; i < 1000; i++)
+                Pool_free(objs[i], 24);
+
+        Pool_flush();
+        Pool_trim();
+
+        fprintf(stderr, ">>>>>>>>>> Tests Passed.\n\n");
+}
+
+void test_pool_threads(void)
+{
+        pthread_t producers[NTHREADS];
+        pthread_t consumers[NTHREADS];
+        void *objs[NTHREADS];
+        int i;
+
+        fprintf(stderr, ">>>>>>>>>>>>>>>>>>>> Testing Pool across threads\n");
+
+        //Valid Cases
+        fprintf(stderr, "Valid Cases --------\n");
+        for (i = 0; i < NTHREADS; i++)
+                pthread_create(&producers[i], NULL, producer, NULL);
+        for (i = 0; i < NTHREADS; i++)
+                pthread_join(producers[i], &objs[i]);
+
+        //free on different threads than the allocating ones
+        for (i = 0; i < NTHREADS; i++)
+                pthread_create(&consumers[i], NULL, consumer, objs[i]);
+        for (i = 0; i < NTHREADS; i++)
+                pthread_join(consumers[i], NULL);
+        fprintf(stderr, "%d objects moved between %d threads\n",
+                NTHREADS * NOBJS, 2 * NTHREADS);
+
+        fprintf(stderr, ">>>>>>>>>> Tests Passed.\n\n");
+}
+
+void test_pool_dlist(void)
+{
+        DLinkedList_T list;
+        int i, j;
+
+        fprintf(stderr, ">>>>>>>>>>>>>>>>>>>> Testing pooled DLinkedList\n");
+
+        //Valid Cases
+        fprintf(stderr, "Valid Cases --------\n");
+        for (j = 0; j < 100; j++) {
+                list = DLinkedList_new(j);
+                for (i = 0; i < 100; i++)
+                        DLinkedList_append(list, &list);
+                assert(DLinkedList_length(list) == 100);
+                DLinkedList_free(&list);
+        }
+
+        fprintf(stderr, ">>>>>>>>>> Tests Passed.\n\n");
+}
+
+/*
+ * Allocates NOBJS pooled objects and returns them as an array
+ */
+void *producer(void *arg)
+{
+        void **objs;
+        int i;
+
+        (void) arg;
+
+        objs = malloc(NOBJS * sizeof(void *));
+        assert(objs != NULL);
+
+        for (i = 0; i < NOBJS; i++) {
+                objs[i] = Pool_alloc(sizeof(void *) * 3);
+                memset(objs[i], i & 0xff, sizeof(void *) * 3);
+        }
+
+        Pool_flush();
+
+        return objs;
+}
+
+/*
+ * Frees an array of pooled objects made by producer
+ */
+void *consumer(void *arg)
+{
+        void **objs = arg;
+        int i;
+
+        for (i = 0; i < NOBJS; i++)
+                Pool_free(objs[i], sizeof(void *) * 3);
+
+        free(objs);
+        Pool_flush();
+
+        return NULL;
+}
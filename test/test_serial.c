@@ -0,0 +1,379 @@
+/*
+ *      filename:       test_serial.c
+ *      author:         @keiferchiang
+ *      date:           18 Oct 2026
+ *      version:        0.0.1
+ *
+ *      description:    Unit tests for the Serial module and the
+ *                      Vector and DLinkedList stream functions
+ */
+
+#include "serial.h"
+#include "vector.h"
+#include "dlinkedlist.h"
+
+/*-------------------------------------
+ * Representation
+ -------------------------------------*/
+typedef struct test {
+        unsigned x;
+        int y;
+} *Test_T;
+
+/*-------------------------------------
+ * Function Prototypes
+ -------------------------------------*/
+void test_serial_vector(bool compress);
+void test_serial_dlist(bool compress);
+void test_serial_large(void);
+void test_serial_corrupt(void);
+
+int test_encode(void *elem, unsigned char *buf, int size, void *cl);
+void *test_decode(const unsigned char *buf, int length, void *cl);
+void test_free(void *elem, void *cl);
+int string_encode(void *elem, unsigned char *buf, int size, void *cl);
+void *string_decode(const unsigned char *buf, int length, void *cl);
+void *bounded_decode(const unsigned char *buf, int length, void *cl);
+
+/*-------------------------------------
+ * Main
+ -------------------------------------*/
+int main(int argc, char *argv[]) {
+        (void) argc, (void) argv;
+
+        fprintf(stderr, "\n"); //formatting
+
+        //Unit Tests
+        test_serial_vector(false);
+        test_serial_vector(true);
+        test_serial_dlist(false);
+        test_serial_dlist(true);
+        test_serial_large();
+        test_serial_corrupt();
+
+        return 0;
+}
+
+/*-------------------------------------
+ * Function Definitions
+ -------------------------------------*/
+void test_serial_vector(bool compress)
+{
+        Serial_Codec_T codec = { test_encode, test_decode, test_free,
+                                 NULL, false };
+        Vector_T vec, copy;
+        Test_T test1, out;
+        FILE *fp;
+        long bytes;
+        bool ok;
+        int i;
+
+        codec.compress = compress;
+
+        fprintf(stderr, ">>>>>>>>>>>>>>>>>>>> Testing Vector_write/read"
+                " (compress: %d)\n", compress);
+
+        //Valid Cases
+        fprintf(stderr, "Valid Cases --------\n");
+        vec = Vector_new(0);
+        for (i = 0; i < 100000; i++) {
+                test1 = malloc(sizeof(struct test));
+                assert(test1 != NULL);
+                test1->x = i % 100;
+                test1->y = -(i % 7);
+                Vector_append(vec, test1);
+        }
+
+        fp = tmpfile();
+        assert(fp != NULL);
+        ok = Vector_write(vec, fp, &codec);
+        assert(ok);
+        bytes = ftell(fp);
+        fprintf(stderr, "bytes for %d elements: %ld\n", Vector_length(vec),
+                bytes);
+
+        rewind(fp);
+        copy = Vector_read(fp, &codec);
+        assert(copy != NULL);
+        assert(Vector_length(copy) == Vector_length(vec));
+        for (i = 0; i < Vector_length(vec); i++) {
+                test1 = Vector_get(vec, i);
+                out = Vector_get(copy, i);
+                assert(test1->x == out->x && test1->y == out->y);
+        }
+        fprintf(stderr, "round trip matches\n");
+
+        //Edge Cases
+        fprintf(stderr, "Edge Cases ---------\n");
+        Vector_clear(&vec);
+        Vector_clear(&copy);
+
+        vec = Vector_new(0); //empty Vector
+        rewind(fp);
+        ok = Vector_write(vec, fp, &codec);
+        assert(ok);
+        rewind(fp);
+        copy = Vector_read(fp, &codec);
+        assert(copy != NULL && Vector_length(copy) == 0);
+        (void) out, (void) ok;
+        Vector_free(&vec);
+        Vector_free(&copy);
+        fclose(fp);
+
+        fprintf(stderr, ">>>>>>>>>> Tests Passed.\n\n");
+}
+
+void test_serial_dlist(bool compress)
+{
+        Serial_Codec_T codec = { test_encode, test_decode, test_free,
+                                 NULL, false };
+        DLinkedList_T list, copy;
+        Test_T test1, out;
+        FILE *fp;
+        bool ok;
+        int i;
+
+        codec.compress = compress;
+
+        fprintf(stderr, ">>>>>>>>>>>>>>>>>>>> Testing DLinkedList_write/read"
+                " (compress: %d)\n", compress);
+
+        //Valid Cases
+        fprintf(stderr, "Valid Cases --------\n");
+        list = DLinkedList_new(0);
+        for (i = 0; i < 1000; i++) {
+                test1 = malloc(sizeof(struct test));
+                assert(test1 != NULL);
+                test1->x = i;
+                test1->y = -i;
+                DLinkedList_prepend(list, test1);
+        }
+
+        fp = tmpfile();
+        assert(fp != NULL);
+        ok = DLinkedList_write(list, fp, &codec);
+        assert(ok);
+
+        rewind(fp);
+        copy = DLinkedList_read(fp, &codec);
+        assert(copy != NULL);
+        assert(DLinkedList_length(copy) == 1000);
+        for (i = 0; i < 1000; i++) {
+                test1 = DLinkedList_get(list, i);
+                out = DLinkedList_get(copy, i);
+                assert(test1->x == out->x && test1->y == out->y);
+                assert(out->x == (unsigned) (999 - i));
+        }
+        fprintf(stderr, "round trip matches\n");
+        (void) out, (void) ok;
+
+        DLinkedList_clear(&list);
+        DLinkedList_clear(&copy);
+        fclose(fp);
+
+        fprintf(stderr, ">>>>>>>>>> Tests Passed.\n\n");
+}
+
+void test_serial_large(void)
+{
+        Serial_Codec_T codec = { string_encode, string_decode,
+                                 test_free, NULL, true };
+        Vector_T vec, copy;
+        char *big;
+        bool ok;
+        int i;
+        FILE *fp;
+
+        fprintf(stderr, ">>>>>>>>>>>>>>>>>>>> Testing elements larger"
+                " than a frame\n");
+
+        //Valid Cases
+        fprintf(stderr, "Valid Cases --------\n");
+        big = malloc(300000);
+        assert(big != NULL);
+        for (i = 0; i < 299999; i++)
+                big[i] = "abcdefgh"[(i / 1000) % 8];
+        big[299999] = '\0';
+
+        vec = Vector_new(0);
+        Vector_append(vec, "small");
+        Vector_append(vec, big);
+        Vector_append(vec, "");
+        Vector_append(vec, "after");
+
+        fp = tmpfile();
+        assert(fp != NULL);
+        ok = Vector_write(vec, fp, &codec);
+        assert(ok);
+        fprintf(stderr, "compressed %d bytes of text into %ld\n",
+                300000 + 13, ftell(fp));
+        rewind(fp);
+        copy = Vector_read(fp, &codec);
+        assert(copy != NULL && Vector_length(copy) == 4);
+        for (i = 0; i < 4; i++)
+                assert(strcmp(Vector_get(vec, i), Vector_get(copy, i)) == 0);
+        fprintf(stderr, "round trip matches\n");
+        (void) ok;
+
+        Vector_clear(&copy);
+        Vector_free(&vec);
+        free(big);
+        fclose(fp);
+
+        fprintf(stderr, ">>>>>>>>>> Tests Passed.\n\n");
+}
+
+void test_serial_corrupt(void)
+{
+        Serial_Codec_T codec = { string_encode, string_decode,
+                                 test_free, NULL, true };
+        Serial_Reader_T reader;
+        Vector_T vec;
+        FILE *fp;
+        void *elem;
+        long size;
+        int limit = 3;
+        bool ok;
+        int i;
+
+        fprintf(stderr, ">>>>>>>>>>>>>>>>>>>> Testing malformed streams\n");
+
+        //Edge Cases
+        fprintf(stderr, "Edge Cases ---------\n");
+        fp = tmpfile();
+        assert(fp != NULL);
+        fputs("not a stream", fp);
+        rewind(fp);
+        vec = Vector_read(fp, &codec);
+        assert(vec == NULL);
+        fprintf(stderr, "bad header rejected\n");
+
+        rewind(fp);
+        vec = Vector_new(0);
+        for (i = 0; i < 1000; i++)
+                Vector_append(vec, "repeated repeated repeated");
+        ok = Vector_write(vec, fp, &codec);
+        assert(ok);
+        Vector_free(&vec);
+
+        size = ftell(fp);
+        for (i = 20; i < size; i += 7) { //flip payload bytes
+                fseek(fp, i, SEEK_SET);
+                fputc(0x7f, fp);
+        }
+        rewind(fp);
+        vec = Vector_read(fp, &codec);
+        fprintf(stderr, "corrupt payload %s\n",
+                vec == NULL ? "rejected" : "decoded");
+        if (vec != NULL)
+                Vector_clear(&vec);
+        fclose(fp);
+
+        fp = tmpfile();
+        assert(fp != NULL);
+        codec.compress = false;
+        vec = Vector_new(0);
+        Vector_append(vec, "abc");
+        Vector_append(vec, "defg");
+        ok = Vector_write(vec, fp, &codec);
+        assert(ok);
+        Vector_free(&vec);
+
+        rewind(fp);
+        codec.decode = bounded_decode;
+        codec.cl = &limit;
+        reader = Serial_reader_new(fp, &codec);
+        assert(reader != NULL);
+        ok = Serial_read(reader, &elem);
+        assert(ok); //"abc" fits the limit
+        free(elem);
+        ok = Serial_read(reader, &elem);
+        assert(!ok && Serial_reader_failed(reader));
+        Serial_reader_free(&reader);
+        fprintf(stderr, "record rejected by the codec\n");
+
+        fseek(fp, 24, SEEK_SET); //"defg" claims 3 bytes, leaving 1 over
+        fputc(3, fp);
+        rewind(fp);
+        codec.decode = string_decode;
+        reader = Serial_reader_new(fp, &codec);
+        assert(reader != NULL);
+        ok = Serial_read(reader, &elem);
+        assert(!ok && Serial_reader_failed(reader));
+        Serial_reader_free(&reader);
+        fprintf(stderr, "frame with a stray byte rejected\n");
+        (void) ok;
+
+        fclose(fp);
+
+        fprintf(stderr, ">>>>>>>>>> Tests Passed.\n\n");
+}
+
+int test_encode(void *elem, unsigned char *buf, int size, void *cl)
+{
+        Test_T test = elem;
+
+        (void) cl;
+
+        if (size >= 8) {
+                memcpy(buf, &test->x, 4);
+                memcpy(buf + 4, &test->y, 4);
+        }
+
+        return 8;
+}
+
+void *test_decode(const unsigned char *buf, int length, void *cl)
+{
+        Test_T test;
+
+        (void) cl, (void) length;
+        assert(length == 8);
+
+        test = malloc(sizeof(struct test));
+        assert(test != NULL);
+        memcpy(&test->x, buf, 4);
+        memcpy(&test->y, buf + 4, 4);
+
+        return test;
+}
+
+void test_free(void *elem, void *cl)
+{
+        (void) cl;
+        free(elem);
+}
+
+int string_encode(void *elem, unsigned char *buf, int size, void *cl)
+{
+        int length = (int) strlen(elem);
+
+        (void) cl;
+
+        if (length <= size)
+                memcpy(buf, elem, length);
+
+        return length;
+}
+
+void *string_decode(const unsigned char *buf, int length, void *cl)
+{
+        char *str;
+
+        (void) cl;
+
+        str = malloc(length + 1);
+        assert(str != NULL);
+        memcpy(str, buf, length);
+        str[length] = '\0';
+
+        return str;
+}
+
+void *bounded_decode(const unsigned char *buf, int length, void *cl)
+{
+        if (length > *(int *) cl)
+                return SERIAL_BAD_RECORD;
+
+        return string_decode(buf, length, NULL);
+}
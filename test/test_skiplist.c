@@ -0,0 +1,426 @@
+/*
+ *      filename:       test_skiplist.c
+ *      author:         @keiferchiang
+ *      date:           18 Oct 2026
+ *      version:        0.0.1
+ *
+ *      description:    Unit tests for the SkipList module
+ */
+
+#ifndef _DEFAULT_SOURCE
+#define _DEFAULT_SOURCE
+#endif
+
+#include <stdint.h>
+#include <pthread.h>
+#include <sched.h>
+
+#include "skiplist.h"
+
+/*-------------------------------------
+ * Constants
+ -------------------------------------*/
+#define LENGTH          100003
+#define NTHREADS        8
+#define ROUNDS          4
+#define HOT_KEYS        8
+#define HOT_OPS         20000
+
+/*-------------------------------------
+ * Representation
+ -------------------------------------*/
+typedef struct worker_t {
+        SkipList_T list;
+        int id;
+        int scans;
+        int net;
+} Worker_T;
+
+typedef struct scan_t {
+        intptr_t prev;
+        intptr_t stop;
+        int count;
+} Scan_T;
+
+/*-------------------------------------
+ * Function Prototypes
+ -------------------------------------*/
+void test_skiplist_single(void);
+void test_skiplist_range(void);
+void test_skiplist_threads(void);
+void test_skiplist_contended(void);
+
+int cmp_int(void *a, void *b, void *cl);
+int cmp_yield(void *a, void *b, void *cl);
+bool check_ascending(void *key, void *value, void *cl);
+void *updater_main(void *arg);
+void *scanner_main(void *arg);
+void *contended_main(void *arg);
+
+/*-------------------------------------
+ * Main
+ -------------------------------------*/
+int main(int argc, char *argv[]) {
+        (void) argc, (void) argv;
+
+        fprintf(stderr, "\n"); //formatting
+
+        //Unit Tests
+        test_skiplist_single();
+        test_skiplist_range();
+        test_skiplist_threads();
+        test_skiplist_contended();
+
+        SkipList_thread_free();
+
+        return 0;
+}
+
+/*-------------------------------------
+ * Function Definitions
+ -------------------------------------*/
+void test_skiplist_single(void)
+{
+        SkipList_T list;
+        void *value;
+        intptr_t key;
+        bool ok;
+        int i;
+
+        fprintf(stderr, ">>>>>>>>>>>>>>>>>>>> Testing SkipList (1 thread)\n");
+
+        //Valid Cases
+        fprintf(stderr, "Valid Cases --------\n");
+        list = SkipList_new(cmp_int, NULL);
+        for (i = 0; i < LENGTH; i++) {
+                key = (i * 7919L) % LENGTH + 1;
+                ok = SkipList_insert(list, (void *) key, (void *) (2 * key));
+                assert(ok);
+        }
+        assert(SkipList_length(list) == LENGTH);
+
+        for (key = 1; key <= LENGTH; key++) {
+                ok = SkipList_get(list, (void *) key, &value);
+                assert(ok);
+                assert((intptr_t) value == 2 * key);
+        }
+        ok = SkipList_insert(list, (void *) 5, (void *) 0);
+        assert(!ok);
+        ok = SkipList_get(list, (void *) 5, &value);
+        assert(ok);
+        assert((intptr_t) value == 10); //duplicate left it alone
+
+        for (key = 2; key <= LENGTH; key += 2) {
+                ok = SkipList_remove(list, (void *) key, &value);
+                assert(ok);
+                assert((intptr_t) value == 2 * key);
+        }
+        assert(SkipList_length(list) == (LENGTH + 1) / 2);
+        for (key = 1; key <= LENGTH; key++) {
+                ok = SkipList_get(list, (void *) key, NULL);
+                assert(ok == (key & 1));
+        }
+        fprintf(stderr, "length after removing evens: %d\n",
+                SkipList_length(list));
+
+        //Edge Cases
+        fprintf(stderr, "Edge Cases ---------\n");
+        ok = SkipList_remove(list, (void *) 2, NULL);
+        assert(!ok);
+        ok = SkipList_get(list, (void *) (LENGTH + 1), NULL);
+        assert(!ok);
+        ok = SkipList_get(list, (void *) -1, NULL);
+        assert(!ok);
+        ok = SkipList_insert(list, (void *) 2, (void *) 7); //re-insert
+        assert(ok);
+        ok = SkipList_get(list, (void *) 2, &value);
+        assert(ok);
+        assert((intptr_t) value == 7);
+        SkipList_free(&list);
+        assert(list == NULL);
+
+        list = SkipList_new(cmp_int, NULL);
+        assert(SkipList_length(list) == 0);
+        ok = SkipList_get(list, (void *) 1, NULL);
+        assert(!ok);
+        ok = SkipList_remove(list, (void *) 1, NULL);
+        assert(!ok);
+        (void) ok;
+        SkipList_free(&list);
+        //SkipList_new(NULL, NULL); //expected assertion
+
+        fprintf(stderr, ">>>>>>>>>> Tests Passed.\n\n");
+}
+
+void test_skiplist_range(void)
+{
+        SkipList_T list;
+        Scan_T scan;
+        intptr_t key;
+        int count;
+
+        fprintf(stderr, ">>>>>>>>>>>>>>>>>>>> Testing SkipList_range\n");
+
+        //Valid Cases
+        fprintf(stderr, "Valid Cases --------\n");
+        list = SkipList_new(cmp_int, NULL);
+        for (key = LENGTH; key > 0; key--)
+                SkipList_insert(list, (void *) (3 * key), (void *) key);
+
+        scan.prev = 0, scan.stop = 0, scan.count = 0;
+        count = SkipList_range(list, NULL, NULL, check_ascending, &scan);
+        assert(count == LENGTH);
+        assert(scan.count == LENGTH && scan.prev == 3 * LENGTH);
+
+        /* [10, 31) holds 12, 15, ..., 30 */
+        scan.prev = 0, scan.count = 0;
+        count = SkipList_range(list, (void *) 10, (void *) 31,
+                               check_ascending, &scan);
+        assert(count == 7 && scan.prev == 30);
+
+        scan.prev = 0, scan.count = 0;
+        count = SkipList_range(list, (void *) 9, (void *) 30,
+                               check_ascending, &scan);
+        assert(count == 7 && scan.prev == 27);
+        fprintf(stderr, "bounded scans ok\n");
+
+        //Edge Cases
+        fprintf(stderr, "Edge Cases ---------\n");
+        scan.prev = 0, scan.stop = 300, scan.count = 0;
+        count = SkipList_range(list, NULL, NULL, check_ascending, &scan);
+        assert(count == 100); //visit stopped at 300
+        scan.prev = 0, scan.stop = 0, scan.count = 0;
+        count = SkipList_range(list, (void *) 31, (void *) 31,
+                               check_ascending, &scan);
+        assert(count == 0);
+        count = SkipList_range(list, (void *) (3 * LENGTH + 1), NULL,
+                               check_ascending, &scan);
+        assert(count == 0);
+        (void) count;
+        //SkipList_range(list, NULL, NULL, NULL, NULL); //expected assertion
+        SkipList_free(&list);
+
+        fprintf(stderr, ">>>>>>>>>> Tests Passed.\n\n");
+}
+
+void test_skiplist_threads(void)
+{
+        SkipList_T list;
+        pthread_t threads[NTHREADS + 1];
+        Worker_T workers[NTHREADS + 1];
+        Scan_T scan;
+        intptr_t key;
+        bool ok;
+        int count;
+        int t, err;
+
+        fprintf(stderr, ">>>>>>>>>>>>>>>>>>>> Testing SkipList (%d threads)\n",
+                NTHREADS + 1);
+
+        //Valid Cases
+        fprintf(stderr, "Valid Cases --------\n");
+        list = SkipList_new(cmp_int, NULL);
+        for (t = 0; t <= NTHREADS; t++) {
+                workers[t].list = list;
+                workers[t].id = t;
+                workers[t].scans = 0;
+                err = pthread_create(&threads[t], NULL,
+                                     t < NTHREADS ? updater_main
+                                                  : scanner_main,
+                                     &workers[t]);
+                assert(err == 0);
+        }
+        for (t = 0; t <= NTHREADS; t++)
+                pthread_join(threads[t], NULL);
+        fprintf(stderr, "scans during updates: %d\n", workers[NTHREADS].scans);
+
+        /* each updater leaves exactly the keys of its own that are odd */
+        assert(SkipList_length(list) == (LENGTH + 1) / 2);
+        for (key = 1; key <= LENGTH; key++) {
+                ok = SkipList_get(list, (void *) key, NULL);
+                assert(ok == (key & 1));
+        }
+        scan.prev = 0, scan.stop = 0, scan.count = 0;
+        count = SkipList_range(list, NULL, NULL, check_ascending, &scan);
+        assert(count == (LENGTH + 1) / 2);
+
+        //Edge Cases
+        fprintf(stderr, "Edge Cases ---------\n");
+        for (key = 1; key <= LENGTH; key += 2) {
+                ok = SkipList_remove(list, (void *) key, NULL);
+                assert(ok);
+        }
+        assert(SkipList_length(list) == 0);
+        (void) ok, (void) count, (void) err;
+        SkipList_free(&list);
+
+        fprintf(stderr, ">>>>>>>>>> Tests Passed.\n\n");
+}
+
+void test_skiplist_contended(void)
+{
+        SkipList_T list;
+        pthread_t threads[NTHREADS];
+        Worker_T workers[NTHREADS];
+        Scan_T scan;
+        int net = 0;
+        int count;
+        int t, err;
+
+        fprintf(stderr, ">>>>>>>>>>>>>>>>>>>> Testing SkipList (%d threads,"
+                " %d shared keys)\n", NTHREADS, HOT_KEYS);
+
+        //Valid Cases
+        fprintf(stderr, "Valid Cases --------\n");
+        list = SkipList_new(cmp_yield, NULL);
+        for (t = 0; t < NTHREADS; t++) {
+                workers[t].list = list;
+                workers[t].id = t;
+                workers[t].net = 0;
+                err = pthread_create(&threads[t], NULL, contended_main,
+                                     &workers[t]);
+                assert(err == 0);
+        }
+        for (t = 0; t < NTHREADS; t++) {
+                pthread_join(threads[t], NULL);
+                net += workers[t].net;
+        }
+
+        /* successful inserts less successful removes is what is left */
+        scan.prev = 0, scan.stop = 0, scan.count = 0;
+        count = SkipList_range(list, NULL, NULL, check_ascending, &scan);
+        fprintf(stderr, "keys left: %d\n", count);
+        assert(count == net);
+        assert(SkipList_length(list) == net);
+
+        //Edge Cases
+        fprintf(stderr, "Edge Cases ---------\n");
+        (void) err;
+        SkipList_free(&list);
+
+        fprintf(stderr, ">>>>>>>>>> Tests Passed.\n\n");
+}
+
+int cmp_int(void *a, void *b, void *cl)
+{
+        intptr_t x = (intptr_t) a;
+        intptr_t y = (intptr_t) b;
+
+        (void) cl;
+
+        return (x > y) - (x < y);
+}
+
+int cmp_yield(void *a, void *b, void *cl)
+{
+        static __thread unsigned calls = 0;
+
+        if (++calls % 2 == 0) //widens the windows between CAS steps
+                sched_yield();
+
+        return cmp_int(a, b, cl);
+}
+
+bool check_ascending(void *key, void *value, void *cl)
+{
+        Scan_T *scan = cl;
+
+        (void) value;
+
+        assert((intptr_t) key > scan->prev);
+        scan->prev = (intptr_t) key;
+        scan->count++;
+
+        return scan->stop == 0 || scan->prev < scan->stop;
+}
+
+void *updater_main(void *arg)
+{
+        Worker_T *worker = arg;
+        intptr_t key;
+        bool ok;
+        int round;
+
+        /* owns the keys congruent to its id; all of them contend */
+        for (round = 0; round < ROUNDS; round++) {
+                for (key = worker->id + 1; key <= LENGTH; key += NTHREADS) {
+                        ok = SkipList_insert(worker->list, (void *) key,
+                                             (void *) key);
+                        assert(ok);
+                }
+                for (key = worker->id + 1; key <= LENGTH; key += NTHREADS) {
+                        if (round == ROUNDS - 1 && (key & 1))
+                                continue;
+                        ok = SkipList_remove(worker->list, (void *) key,
+                                             NULL);
+                        assert(ok);
+                }
+        }
+        (void) ok;
+
+        SkipList_thread_free();
+
+        return NULL;
+}
+
+void *scanner_main(void *arg)
+{
+        Worker_T *worker = arg;
+        Scan_T scan;
+        int i;
+
+        for (i = 0; i < 20; i++) {
+                scan.prev = 0, scan.stop = 0, scan.count = 0;
+                SkipList_range(worker->list, NULL, NULL, check_ascending,
+                               &scan);
+                scan.prev = 0;
+                SkipList_range(worker->list, (void *) (LENGTH / 2), NULL,
+                               check_ascending, &scan);
+                worker->scans += 2;
+        }
+
+        SkipList_thread_free();
+
+        return NULL;
+}
+
+void *contended_main(void *arg)
+{
+        Worker_T *worker = arg;
+        uint32_t x = 2654435761u * (worker->id + 1);
+        void *value;
+        intptr_t key;
+        bool found;
+        int i;
+
+        /* every thread inserts, removes and looks up the same few keys */
+        for (i = 0; i < HOT_OPS; i++) {
+                x ^= x << 13;
+                x ^= x >> 17;
+                x ^= x << 5;
+                key = x % HOT_KEYS + 1;
+
+                switch (x >> 30) {
+                case 0:
+                case 1:
+                        if (SkipList_insert(worker->list, (void *) key,
+                                            (void *) key))
+                                worker->net++;
+                        break;
+                case 2:
+                        if (SkipList_remove(worker->list, (void *) key, NULL))
+                                worker->net--;
+                        break;
+                default:
+                        found = SkipList_get(worker->list, (void *) key,
+                                             &value);
+                        assert(!found || value == (void *) key);
+                        (void) found;
+                        break;
+                }
+        }
+
+        SkipList_thread_free();
+
+        return NULL;
+}
@@ -0,0 +1,203 @@
+/*
+ *      filename:       test_slotmap.c
+ *      author:         @keiferchiang
+ *      date:           18 Oct 2026
+ *      version:        0.0.1
+ *
+ *      description:    Unit tests for the SlotMap module
+ */
+
+#include "slotmap.h"
+
+/*-------------------------------------
+ * Constants
+ -------------------------------------*/
+#define LENGTH          100003
+
+/*-------------------------------------
+ * Function Prototypes
+ -------------------------------------*/
+void test_slotmap_insert(void);
+void test_slotmap_remove(void);
+void test_slotmap_iter(void);
+
+/*-------------------------------------
+ * Main
+ -------------------------------------*/
+int main(int argc, char *argv[]) {
+        (void) argc, (void) argv;
+
+        fprintf(stderr, "\n"); //formatting
+
+        //Unit Tests
+        test_slotmap_insert();
+        test_slotmap_remove();
+        test_slotmap_iter();
+
+        return 0;
+}
+
+/*-------------------------------------
+ * Function Definitions
+ -------------------------------------*/
+void test_slotmap_insert(void)
+{
+        SlotMap_T map;
+        uint64_t *handles;
+        int i;
+
+        fprintf(stderr, ">>>>>>>>>>>>>>>>>>>> Testing SlotMap_insert\n");
+
+        //Valid Cases
+        fprintf(stderr, "Valid Cases --------\n");
+        map = SlotMap_new(0);
+        handles = malloc(LENGTH * sizeof(uint64_t));
+        assert(handles != NULL);
+
+        for (i = 0; i < LENGTH; i++) {
+                handles[i] = SlotMap_insert(map, Vector_int(i));
+                assert(handles[i] != SLOTMAP_NIL);
+        }
+        assert(SlotMap_length(map) == LENGTH);
+        for (i = 0; i < LENGTH; i++) {
+                assert(SlotMap_contains(map, handles[i]));
+                assert(Vector_toint(SlotMap_get(map, handles[i])) == i);
+                assert(SlotMap_handle(map, i) == handles[i]);
+        }
+        fprintf(stderr, "inserted: %d\n", SlotMap_length(map));
+
+        //Edge Cases
+        fprintf(stderr, "Edge Cases ---------\n");
+        assert(!SlotMap_contains(map, SLOTMAP_NIL));
+        assert(SlotMap_get(map, SLOTMAP_NIL) == NULL);
+        assert(!SlotMap_contains(map, (uint64_t) 1 << 32 | LENGTH));
+        assert(!SlotMap_contains(map, handles[0] + ((uint64_t) 1 << 32)));
+        free(handles);
+        SlotMap_free(&map);
+        assert(map == NULL);
+        //SlotMap_new(-1); //expected assertion
+        //SlotMap_insert(NULL, NULL); //expected assertion
+
+        fprintf(stderr, ">>>>>>>>>> Tests Passed.\n\n");
+}
+
+void test_slotmap_remove(void)
+{
+        SlotMap_T map;
+        uint64_t *handles;
+        uint64_t reused;
+        void *elem;
+        bool ok;
+        int i;
+
+        fprintf(stderr, ">>>>>>>>>>>>>>>>>>>> Testing SlotMap_remove\n");
+
+        //Valid Cases
+        fprintf(stderr, "Valid Cases --------\n");
+        map = SlotMap_new(LENGTH);
+        handles = malloc(LENGTH * sizeof(uint64_t));
+        assert(handles != NULL);
+        for (i = 0; i < LENGTH; i++)
+                handles[i] = SlotMap_insert(map, Vector_int(i));
+
+        for (i = 0; i < LENGTH; i += 3) {
+                ok = SlotMap_remove(map, handles[i], &elem);
+                assert(ok && Vector_toint(elem) == i);
+        }
+        assert(SlotMap_length(map) == LENGTH - (LENGTH + 2) / 3);
+        for (i = 0; i < LENGTH; i++) {
+                if (i % 3 == 0) {
+                        assert(!SlotMap_contains(map, handles[i]));
+                        assert(SlotMap_get(map, handles[i]) == NULL);
+                } else {
+                        assert(Vector_toint(SlotMap_get(map, handles[i]))
+                               == i);
+                }
+        }
+        fprintf(stderr, "remaining: %d\n", SlotMap_length(map));
+
+        //stale handles stay stale once their slot is reused
+        reused = SlotMap_insert(map, Vector_int(-1));
+        assert((uint32_t) reused == (uint32_t) handles[LENGTH - 1 -
+                                                       (LENGTH - 1) % 3]);
+        assert(reused != handles[LENGTH - 1 - (LENGTH - 1) % 3]);
+        for (i = 0; i < LENGTH; i += 3)
+                assert(!SlotMap_contains(map, handles[i]));
+        assert(Vector_toint(SlotMap_get(map, reused)) == -1);
+
+        //Edge Cases
+        fprintf(stderr, "Edge Cases ---------\n");
+        ok = SlotMap_remove(map, handles[0], &elem); //already removed
+        assert(!ok);
+        ok = SlotMap_remove(map, SLOTMAP_NIL, NULL);
+        assert(!ok);
+        ok = SlotMap_remove(map, reused, NULL);
+        assert(ok);
+        ok = SlotMap_remove(map, reused, NULL);
+        assert(!ok);
+        for (i = 1; i < LENGTH; i++) {
+                if (i % 3 != 0) {
+                        ok = SlotMap_remove(map, handles[i], NULL);
+                        assert(ok);
+                }
+        }
+        assert(SlotMap_length(map) == 0);
+        (void) ok;
+        free(handles);
+        SlotMap_free(&map);
+
+        fprintf(stderr, ">>>>>>>>>> Tests Passed.\n\n");
+}
+
+void test_slotmap_iter(void)
+{
+        SlotMap_T map;
+        Iter_T iter;
+        Vector_T values;
+        uint64_t handles[10];
+        intptr_t sum = 0;
+        void *elem;
+        int count = 0;
+        int i;
+
+        fprintf(stderr, ">>>>>>>>>>>>>>>>>>>> Testing SlotMap_iter\n");
+
+        //Valid Cases
+        fprintf(stderr, "Valid Cases --------\n");
+        map = SlotMap_new(0);
+        for (i = 0; i < 10; i++)
+                handles[i] = SlotMap_insert(map, Vector_int(i));
+        SlotMap_remove(map, handles[2], NULL);
+        SlotMap_remove(map, handles[5], NULL);
+
+        iter = SlotMap_iter(map);
+        CDS_FOREACH(elem, iter) {
+                sum += Vector_toint(elem);
+                count++;
+        }
+        assert(count == 8);
+        assert(sum == 45 - 2 - 5);
+
+        //dense index and handle agree
+        values = SlotMap_values(map);
+        for (i = 0; i < SlotMap_length(map); i++)
+                assert(SlotMap_get(map, SlotMap_handle(map, i)) ==
+                       Vector_get(values, i));
+        fprintf(stderr, "sum over %d elements: %ld\n", count, (long) sum);
+
+        //Edge Cases
+        fprintf(stderr, "Edge Cases ---------\n");
+        Vector_set(values, Vector_int(100), 0); //in-place update
+        assert(Vector_toint(SlotMap_get(map, SlotMap_handle(map, 0))) == 100);
+        for (i = 0; i < 10; i++)
+                SlotMap_remove(map, handles[i], NULL);
+        iter = SlotMap_iter(map);
+        count = 0;
+        CDS_FOREACH(elem, iter)
+                count++;
+        assert(count == 0);
+        SlotMap_free(&map);
+        //SlotMap_handle(map, 0); //expected assertion
+
+        fprintf(stderr, ">>>>>>>>>> Tests Passed.\n\n");
+}
@@ -0,0 +1,173 @@
+/*
+ *      filename:       test_sparseset.c
+ *      author:         @keiferchiang
+ *      date:           18 Oct 2026
+ *      version:        0.0.1
+ *
+ *      description:    Unit tests for the SparseSet module
+ */
+
+#include "sparseset.h"
+
+/*-------------------------------------
+ * Constants
+ -------------------------------------*/
+#define UNIVERSE        1000003
+#define TICKS           100
+
+/*-------------------------------------
+ * Function Prototypes
+ -------------------------------------*/
+void test_sparseset_insert(void);
+void test_sparseset_remove(void);
+void test_sparseset_clear(void);
+
+/*-------------------------------------
+ * Main
+ -------------------------------------*/
+int main(int argc, char *argv[]) {
+        (void) argc, (void) argv;
+
+        fprintf(stderr, "\n"); //formatting
+
+        //Unit Tests
+        test_sparseset_insert();
+        test_sparseset_remove();
+        test_sparseset_clear();
+
+        return 0;
+}
+
+/*-------------------------------------
+ * Function Definitions
+ -------------------------------------*/
+void test_sparseset_insert(void)
+{
+        SparseSet_T set;
+        bool ok;
+        int i;
+
+        fprintf(stderr, ">>>>>>>>>>>>>>>>>>>> Testing SparseSet_insert\n");
+
+        //Valid Cases
+        fprintf(stderr, "Valid Cases --------\n");
+        set = SparseSet_new(UNIVERSE);
+        assert(SparseSet_universe(set) == UNIVERSE);
+        for (i = UNIVERSE - 1; i >= 0; i -= 7) {
+                ok = SparseSet_insert(set, i);
+                assert(ok);
+        }
+        assert(SparseSet_length(set) == (UNIVERSE + 6) / 7);
+        for (i = 0; i < UNIVERSE; i++)
+                assert(SparseSet_contains(set, i) ==
+                       ((UNIVERSE - 1 - i) % 7 == 0));
+        for (i = 0; i < SparseSet_length(set); i++) //insertion order
+                assert(SparseSet_get(set, i) == UNIVERSE - 1 - 7 * i);
+        fprintf(stderr, "members: %d of %d\n", SparseSet_length(set),
+                UNIVERSE);
+
+        //Edge Cases
+        fprintf(stderr, "Edge Cases ---------\n");
+        ok = SparseSet_insert(set, UNIVERSE - 1); //already a member
+        assert(!ok);
+        assert(SparseSet_length(set) == (UNIVERSE + 6) / 7);
+        (void) ok;
+        SparseSet_free(&set);
+        assert(set == NULL);
+        set = SparseSet_new(0);
+        assert(SparseSet_length(set) == 0);
+        //SparseSet_insert(set, 0); //expected assertion
+        SparseSet_free(&set);
+
+        fprintf(stderr, ">>>>>>>>>> Tests Passed.\n\n");
+}
+
+void test_sparseset_remove(void)
+{
+        SparseSet_T set;
+        bool ok;
+        int i;
+
+        fprintf(stderr, ">>>>>>>>>>>>>>>>>>>> Testing SparseSet_remove\n");
+
+        //Valid Cases
+        fprintf(stderr, "Valid Cases --------\n");
+        set = SparseSet_new(UNIVERSE);
+        for (i = 0; i < UNIVERSE; i++)
+                SparseSet_insert(set, i);
+        for (i = 0; i < UNIVERSE; i += 2) {
+                ok = SparseSet_remove(set, i);
+                assert(ok);
+        }
+        assert(SparseSet_length(set) == UNIVERSE / 2);
+        for (i = 0; i < UNIVERSE; i++)
+                assert(SparseSet_contains(set, i) == (i % 2 == 1));
+        for (i = 0; i < SparseSet_length(set); i++)
+                assert(SparseSet_get(set, i) % 2 == 1);
+        fprintf(stderr, "odd members: %d\n", SparseSet_length(set));
+
+        //Edge Cases
+        fprintf(stderr, "Edge Cases ---------\n");
+        ok = SparseSet_remove(set, 0); //not a member
+        assert(!ok);
+        for (i = 1; i < UNIVERSE; i += 2) {
+                ok = SparseSet_remove(set, i);
+                assert(ok);
+        }
+        assert(SparseSet_length(set) == 0);
+        assert(!SparseSet_contains(set, 1));
+        ok = SparseSet_insert(set, 1);
+        assert(ok);
+        assert(SparseSet_get(set, 0) == 1);
+        (void) ok;
+        //SparseSet_remove(set, UNIVERSE); //expected assertion
+        SparseSet_free(&set);
+
+        fprintf(stderr, ">>>>>>>>>> Tests Passed.\n\n");
+}
+
+void test_sparseset_clear(void)
+{
+        SparseSet_T set;
+        Iter_T iter;
+        void *elem;
+        long sum;
+        int tick;
+        int i;
+
+        fprintf(stderr, ">>>>>>>>>>>>>>>>>>>> Testing SparseSet_clear\n");
+
+        //Valid Cases
+        fprintf(stderr, "Valid Cases --------\n");
+        set = SparseSet_new(UNIVERSE);
+        for (tick = 0; tick < TICKS; tick++) {
+                SparseSet_clear(set);
+                assert(SparseSet_length(set) == 0);
+                for (i = tick; i < UNIVERSE; i += UNIVERSE / 97)
+                        SparseSet_insert(set, i);
+                assert(!SparseSet_contains(set, tick == 0 ? 1 : tick - 1));
+
+                sum = 0;
+                iter = SparseSet_iter(set);
+                CDS_FOREACH(elem, iter) {
+                        assert(SparseSet_contains(set,
+                                                  (int) Vector_toint(elem)));
+                        sum += (long) Vector_toint(elem);
+                }
+                assert(sum > 0 || tick == 0);
+        }
+        fprintf(stderr, "members after %d ticks: %d\n", TICKS,
+                SparseSet_length(set));
+
+        //Edge Cases
+        fprintf(stderr, "Edge Cases ---------\n");
+        SparseSet_clear(set);
+        SparseSet_clear(set);
+        for (i = 0; i < UNIVERSE; i += UNIVERSE / 97)
+                assert(!SparseSet_contains(set, i)); //stale sparse entries
+        assert(Vector_length(SparseSet_values(set)) == 0);
+        SparseSet_free(&set);
+        //SparseSet_clear(NULL); //expected assertion
+
+        fprintf(stderr, ">>>>>>>>>> Tests Passed.\n\n");
+}
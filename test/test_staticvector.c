@@ -0,0 +1,168 @@
+/*
+ *      filename:       test_staticvector.c
+ *      author:         @keiferchiang
+ *      date:           18 Oct 2026
+ *      version:        0.0.1
+ *
+ *      description:    Unit tests for the StaticVector header
+ */
+
+#include <stdint.h>
+
+#include "staticvector.h"
+
+/*-------------------------------------
+ * Constants
+ -------------------------------------*/
+#define CAPACITY        16
+
+/*-------------------------------------
+ * Representation
+ -------------------------------------*/
+typedef struct request_t {
+        int id;
+        StaticVector_T(CAPACITY) args;
+} Request_T;
+
+/*-------------------------------------
+ * Function Prototypes
+ -------------------------------------*/
+void test_staticvector_append(void);
+void test_staticvector_remove(void);
+void test_staticvector_member(void);
+
+/*-------------------------------------
+ * Main
+ -------------------------------------*/
+int main(int argc, char *argv[]) {
+        (void) argc, (void) argv;
+
+        fprintf(stderr, "\n"); //formatting
+
+        //Unit Tests
+        test_staticvector_append();
+        test_staticvector_remove();
+        test_staticvector_member();
+
+        return 0;
+}
+
+/*-------------------------------------
+ * Function Definitions
+ -------------------------------------*/
+void test_staticvector_append(void)
+{
+        StaticVector_T(CAPACITY) sv;
+        int i;
+
+        fprintf(stderr, ">>>>>>>>>>>>>>>>>>>> Testing StaticVector_append\n");
+
+        //Valid Cases
+        fprintf(stderr, "Valid Cases --------\n");
+        StaticVector_init(&sv);
+        assert(StaticVector_capacity(&sv) == CAPACITY);
+        assert(StaticVector_length(&sv) == 0);
+        for (i = 0; i < CAPACITY; i++) {
+                assert(!StaticVector_full(&sv));
+                StaticVector_append(&sv, (void *) (intptr_t) i);
+        }
+        assert(StaticVector_full(&sv));
+        for (i = 0; i < CAPACITY; i++)
+                assert((intptr_t) StaticVector_get(&sv, i) == i);
+        assert((intptr_t) StaticVector_last(&sv) == CAPACITY - 1);
+        assert((intptr_t) StaticVector_data(&sv)[3] == 3);
+        fprintf(stderr, "length: %d of %d\n", StaticVector_length(&sv),
+                StaticVector_capacity(&sv));
+
+        //Edge Cases
+        fprintf(stderr, "Edge Cases ---------\n");
+        StaticVector_set(&sv, NULL, 0);
+        assert(StaticVector_get(&sv, 0) == NULL);
+        //StaticVector_append(&sv, NULL); //expected assertion
+        //StaticVector_get(&sv, CAPACITY); //expected assertion
+        StaticVector_init(&sv);
+        assert(StaticVector_length(&sv) == 0);
+        StaticVector_set(&sv, (void *) 1, 0); //index == length appends
+        assert(StaticVector_length(&sv) == 1);
+        //StaticVector_set(&sv, NULL, 2); //expected assertion
+
+        fprintf(stderr, ">>>>>>>>>> Tests Passed.\n\n");
+}
+
+void test_staticvector_remove(void)
+{
+        StaticVector_T(CAPACITY) sv;
+        int i;
+
+        fprintf(stderr, ">>>>>>>>>>>>>>>>>>>> Testing StaticVector_remove\n");
+
+        //Valid Cases
+        fprintf(stderr, "Valid Cases --------\n");
+        StaticVector_init(&sv);
+        for (i = 0; i < CAPACITY; i++)
+                StaticVector_append(&sv, (void *) (intptr_t) i);
+
+        StaticVector_remove(&sv, 0);
+        assert(StaticVector_length(&sv) == CAPACITY - 1);
+        for (i = 0; i < CAPACITY - 1; i++)
+                assert((intptr_t) StaticVector_get(&sv, i) == i + 1);
+
+        StaticVector_swap_remove(&sv, 0);
+        assert((intptr_t) StaticVector_get(&sv, 0) == CAPACITY - 1);
+        assert(StaticVector_length(&sv) == CAPACITY - 2);
+
+        StaticVector_removehi(&sv);
+        assert((intptr_t) StaticVector_last(&sv) == CAPACITY - 3);
+        fprintf(stderr, "length: %d\n", StaticVector_length(&sv));
+
+        //Edge Cases
+        fprintf(stderr, "Edge Cases ---------\n");
+        StaticVector_remove(&sv, StaticVector_length(&sv) - 1); //last
+        while (StaticVector_length(&sv) > 0)
+                StaticVector_swap_remove(&sv, 0);
+        //StaticVector_removehi(&sv); //expected assertion
+        //StaticVector_remove(&sv, 0); //expected assertion
+
+        fprintf(stderr, ">>>>>>>>>> Tests Passed.\n\n");
+}
+
+void test_staticvector_member(void)
+{
+        Request_T req;
+        Request_T copy;
+        Iter_T iter;
+        void *elem;
+        intptr_t sum = 0;
+        bool ok;
+        int i;
+
+        fprintf(stderr, ">>>>>>>>>>>>>>>>>>>> Testing StaticVector member\n");
+
+        //Valid Cases
+        fprintf(stderr, "Valid Cases --------\n");
+        req.id = 7;
+        StaticVector_init(&req.args);
+        for (i = 1; i <= 10; i++)
+                StaticVector_append(&req.args, (void *) (intptr_t) i);
+
+        iter = StaticVector_iter(&req.args);
+        CDS_FOREACH(elem, iter)
+                sum += (intptr_t) elem;
+        assert(sum == 55);
+
+        copy = req; //plain struct copy, no ownership to track
+        StaticVector_removehi(&req.args);
+        assert(StaticVector_length(&copy.args) == 10);
+        assert(StaticVector_length(&req.args) == 9);
+        fprintf(stderr, "sum of args: %ld\n", (long) sum);
+
+        //Edge Cases
+        fprintf(stderr, "Edge Cases ---------\n");
+        StaticVector_init(&req.args);
+        iter = StaticVector_iter(&req.args);
+        ok = Iter_next(&iter, &elem);
+        assert(!ok);
+        (void) copy, (void) ok;
+
+        fprintf(stderr, ">>>>>>>>>> Tests Passed.\n\n");
+}
@@ -0,0 +1,213 @@
+/*
+ *      filename:       test_topk.c
+ *      author:         @keiferchiang
+ *      date:           18 Oct 2026
+ *      version:        0.0.1
+ *
+ *      description:    Unit tests for the TopK module
+ */
+
+#include <stdint.h>
+
+#include "topk.h"
+
+/*-------------------------------------
+ * Constants
+ -------------------------------------*/
+#define LENGTH          1000003
+#define K               100
+#define NSHARDS         4
+
+/*-------------------------------------
+ * Function Prototypes
+ -------------------------------------*/
+void test_topk_push(void);
+void test_topk_iter(void);
+void test_topk_merge(void);
+
+int cmp_int(void *a, void *b, void *cl);
+bool is_even(void *elem, void *cl);
+intptr_t scramble(int i);
+
+/*-------------------------------------
+ * Main
+ -------------------------------------*/
+int main(int argc, char *argv[]) {
+        (void) argc, (void) argv;
+
+        fprintf(stderr, "\n"); //formatting
+
+        //Unit Tests
+        test_topk_push();
+        test_topk_iter();
+        test_topk_merge();
+
+        return 0;
+}
+
+/*-------------------------------------
+ * Function Definitions
+ -------------------------------------*/
+void test_topk_push(void)
+{
+        TopK_T top;
+        Vector_T vec, best;
+        bool ok;
+        int i;
+
+        fprintf(stderr, ">>>>>>>>>>>>>>>>>>>> Testing TopK_push\n");
+
+        //Valid Cases
+        fprintf(stderr, "Valid Cases --------\n");
+        vec = Vector_new(0);
+        for (i = 0; i < LENGTH; i++)
+                Vector_append(vec, Vector_int(scramble(i)));
+
+        top = TopK_new(K, cmp_int, NULL);
+        TopK_push_vector(top, vec);
+        assert(TopK_length(top) == K);
+        assert(Vector_toint(TopK_min(top)) == LENGTH - K);
+
+        best = TopK_vector(top);
+        assert(Vector_length(best) == K);
+        for (i = 0; i < K; i++)
+                assert(Vector_toint(Vector_get(best, i)) == LENGTH - 1 - i);
+        fprintf(stderr, "top %d of %d: %ld .. %ld\n", K, LENGTH,
+                (long) Vector_toint(Vector_first(best)),
+                (long) Vector_toint(Vector_last(best)));
+        assert(TopK_length(top) == K); //left unchanged
+        Vector_free(&best);
+
+        //Edge Cases
+        fprintf(stderr, "Edge Cases ---------\n");
+        ok = TopK_push(top, Vector_int(0));
+        assert(!ok);
+        ok = TopK_push(top, Vector_int(LENGTH - K)); //ties rejected
+        assert(!ok);
+        ok = TopK_push(top, Vector_int(LENGTH));
+        assert(ok);
+        assert(Vector_toint(TopK_min(top)) == LENGTH - K + 1);
+        (void) ok;
+        TopK_free(&top);
+        assert(top == NULL);
+
+        top = TopK_new(K, cmp_int, NULL); //fewer elements than k
+        best = TopK_vector(top);
+        assert(Vector_length(best) == 0);
+        Vector_free(&best);
+        TopK_push(top, Vector_int(2));
+        TopK_push(top, Vector_int(-5));
+        TopK_push(top, Vector_int(7));
+        best = TopK_vector(top);
+        assert(Vector_length(best) == 3);
+        assert(Vector_toint(Vector_get(best, 0)) == 7);
+        assert(Vector_toint(Vector_get(best, 2)) == -5);
+        Vector_free(&best);
+        TopK_free(&top);
+        Vector_free(&vec);
+        //TopK_new(0, cmp_int, NULL); //expected assertion
+
+        fprintf(stderr, ">>>>>>>>>> Tests Passed.\n\n");
+}
+
+void test_topk_iter(void)
+{
+        TopK_T top;
+        Vector_T vec, best;
+        Iter_T it, evens;
+        int i;
+
+        fprintf(stderr, ">>>>>>>>>>>>>>>>>>>> Testing TopK_push_iter\n");
+
+        //Valid Cases
+        fprintf(stderr, "Valid Cases --------\n");
+        vec = Vector_new(0);
+        for (i = 0; i < LENGTH; i++)
+                Vector_append(vec, Vector_int(scramble(i)));
+
+        top = TopK_new(10, cmp_int, NULL);
+        it = Vector_iter(vec);
+        evens = Iter_filter(&it, is_even, NULL);
+        TopK_push_iter(top, &evens);
+
+        best = TopK_vector(top);
+        for (i = 0; i < 10; i++)
+                assert(Vector_toint(Vector_get(best, i)) ==
+                       LENGTH - 1 - 2 * i);
+        fprintf(stderr, "top 10 even: %ld .. %ld\n",
+                (long) Vector_toint(Vector_first(best)),
+                (long) Vector_toint(Vector_last(best)));
+        Vector_free(&best);
+
+        //Edge Cases
+        fprintf(stderr, "Edge Cases ---------\n");
+        TopK_push_iter(top, &evens); //already drained
+        assert(TopK_length(top) == 10);
+        TopK_free(&top);
+        Vector_free(&vec);
+
+        fprintf(stderr, ">>>>>>>>>> Tests Passed.\n\n");
+}
+
+void test_topk_merge(void)
+{
+        TopK_T shards[NSHARDS];
+        TopK_T top;
+        Vector_T best;
+        int s, i;
+
+        fprintf(stderr, ">>>>>>>>>>>>>>>>>>>> Testing TopK_merge\n");
+
+        //Valid Cases
+        fprintf(stderr, "Valid Cases --------\n");
+        for (s = 0; s < NSHARDS; s++)
+                shards[s] = TopK_new(K, cmp_int, NULL);
+        for (i = 0; i < LENGTH; i++)
+                TopK_push(shards[i % NSHARDS], Vector_int(scramble(i)));
+
+        top = TopK_new(K, cmp_int, NULL);
+        for (s = 0; s < NSHARDS; s++)
+                TopK_merge(top, shards[s]);
+
+        best = TopK_vector(top);
+        assert(Vector_length(best) == K);
+        for (i = 0; i < K; i++)
+                assert(Vector_toint(Vector_get(best, i)) == LENGTH - 1 - i);
+        fprintf(stderr, "merged %d shards\n", NSHARDS);
+        Vector_free(&best);
+
+        //Edge Cases
+        fprintf(stderr, "Edge Cases ---------\n");
+        assert(TopK_length(shards[0]) == K); //sources left unchanged
+        TopK_free(&shards[0]);
+        shards[0] = TopK_new(K, cmp_int, NULL);
+        TopK_merge(top, shards[0]); //empty source
+        assert(TopK_length(top) == K);
+
+        for (s = 0; s < NSHARDS; s++)
+                TopK_free(&shards[s]);
+        TopK_free(&top);
+
+        fprintf(stderr, ">>>>>>>>>> Tests Passed.\n\n");
+}
+
+int cmp_int(void *a, void *b, void *cl)
+{
+        (void) cl;
+        return (Vector_toint(a) > Vector_toint(b)) -
+               (Vector_toint(a) < Vector_toint(b));
+}
+
+bool is_even(void *elem, void *cl)
+{
+        (void) cl;
+        return Vector_toint(elem) % 2 == 0;
+}
+
+/*
+ * A permutation of [0, LENGTH), since LENGTH is prime
+ */
+intptr_t scramble(int i)
+{
+        return (intptr_t) ((i * 7919LL) % LENGTH);
+}
@@ -1,3 +1,5 @@
+#include <unistd.h>
+
 #include "vector.h"
 
 /*-------------------------------------
@@ -18,6 +20,14 @@ void test_vector_lo(Vector_T vec);
 void test_vector_hi(Vector_T vec);
 void test_vector_remove(Vector_T vec);
 void test_vector_pops(Vector_T vec);
+void test_vector_swap_remove(void);
+void test_vector_compact(void);
+void test_vector_cache(void);
+void test_vector_clear(void);
+void test_vector_writev(void);
+size_t record_length(void *elem, void *cl);
+void count_free(void *elem, void *cl);
+void count_free_batch(void **elems, int length, void *cl);
 
 /*-------------------------------------
  * Main
@@ -46,6 +56,11 @@ int main(int argc, char *argv[]) {
         test_vector_hi(vec);
         test_vector_remove(vec);
         test_vector_pops(vec);
+        test_vector_swap_remove();
+        test_vector_compact();
+        test_vector_cache();
+        test_vector_clear();
+        test_vector_writev();
 
         //Cleanup
         free(test1);
@@ -339,3 +354,302 @@ void test_vector_pops(Vector_T vec)
         fprintf(stderr, ">>>>>>>>>> Tests Passed.\n\n");
         free(test2);
 }
+
+void test_vector_clear(void)
+{
+        Vector_T vec;
+        Vector_T null_vec = NULL;
+        Test_T test2;
+        int freed = 0;
+        int i;
+
+        fprintf(stderr, ">>>>>>>>>>>>>>>>>>>> Testing own & clear\n");
+
+        //Valid Cases
+        fprintf(stderr, "Valid Cases --------\n");
+        vec = Vector_new(0);
+        for (i = 0; i < 100; i++) {
+                test2 = malloc(sizeof(struct test));
+                assert(test2 != NULL);
+                Vector_append(vec, test2);
+        }
+        Vector_clear(&vec); //default destructor is free
+        assert(vec == NULL);
+
+        vec = Vector_new(0);
+        Vector_own(vec, count_free, NULL, &freed);
+        for (i = 0; i < 100; i++)
+                Vector_append(vec, &freed);
+        Vector_clear(&vec);
+        fprintf(stderr, "freed one by one: %d\n", freed);
+        assert(freed == 100);
+
+        freed = 0;
+        vec = Vector_new(0);
+        Vector_own(vec, count_free, count_free_batch, &freed);
+        for (i = 0; i < 100; i++)
+                Vector_append(vec, &freed);
+        Vector_clear(&vec);
+        fprintf(stderr, "freed in batch: %d\n", freed);
+        assert(freed == 100);
+
+        //Edge Cases
+        (void) null_vec;
+        fprintf(stderr, "Edge Cases ---------\n");
+        freed = 0;
+        vec = Vector_new(0);
+        Vector_own(vec, count_free, NULL, &freed);
+        Vector_append(vec, NULL); //NULL elements are skipped
+        Vector_clear(&vec);
+        assert(freed == 0);
+        //Vector_clear(&null_vec); //expected assertion
+
+        fprintf(stderr, ">>>>>>>>>> Tests Passed.\n\n");
+}
+
+void test_vector_writev(void)
+{
+        static char records[] = "abcdefghijklmnop";
+        static char tail[] = "qrst";
+        struct iovec iov[4];
+        char out[32];
+        size_t size = 4;
+        Vector_T vec;
+        ssize_t written;
+        int fds[2];
+        int index = 0;
+        int count;
+        int rc;
+        int i;
+
+        fprintf(stderr, ">>>>>>>>>>>>>>>>>>>> Testing Vector_iovec & writev\n");
+
+        //Valid Cases
+        fprintf(stderr, "Valid Cases --------\n");
+        vec = Vector_new(0);
+        for (i = 0; i < 4; i++)
+                Vector_append(vec, records + 4 * i);
+        Vector_append(vec, tail);
+
+        count = Vector_iovec(vec, &index, iov, 4, record_length, &size);
+        fprintf(stderr, "5 buffers in %d iovecs\n", count);
+        assert(count == 2 && index == 5);
+        assert(iov[0].iov_base == records && iov[0].iov_len == 16);
+        assert(iov[1].iov_base == tail && iov[1].iov_len == 4);
+
+        index = 0;
+        count = Vector_iovec(vec, &index, iov, 1, record_length, &size);
+        assert(count == 1 && index == 4); //stops at a full iov
+        count = Vector_iovec(vec, &index, iov, 1, record_length, &size);
+        assert(count == 1 && index == 5);
+        count = Vector_iovec(vec, &index, iov, 1, record_length, &size);
+        assert(count == 0 && index == 5);
+
+        rc = pipe(fds);
+        assert(rc == 0);
+        written = Vector_writev(vec, fds[1], record_length, &size);
+        assert(written == 20);
+        written = read(fds[0], out, sizeof(out));
+        assert(written == 20);
+        assert(memcmp(out, "abcdefghijklmnopqrst", 20) == 0);
+        fprintf(stderr, "writev matches\n");
+
+        //Edge Cases
+        fprintf(stderr, "Edge Cases ---------\n");
+        size = 0; //empty buffers are skipped
+        index = 0;
+        count = Vector_iovec(vec, &index, iov, 4, record_length, &size);
+        assert(count == 0);
+        written = Vector_writev(vec, fds[1], record_length, &size);
+        assert(written == 0);
+        (void) rc, (void) written;
+        close(fds[0]);
+        close(fds[1]);
+        Vector_free(&vec);
+        //Vector_iovec(vec, &index, NULL, 4, record_length, &size); //expected assertion
+
+        fprintf(stderr, ">>>>>>>>>> Tests Passed.\n\n");
+}
+
+void count_free(void *elem, void *cl)
+{
+        (void) elem;
+        (*(int *) cl)++;
+}
+
+void count_free_batch(void **elems, int length, void *cl)
+{
+        (void) elems;
+        *(int *) cl += length;
+}
+
+void test_vector_swap_remove(void)
+{
+        Vector_T vec;
+        intptr_t i;
+
+        fprintf(stderr, ">>>>>>>>>>>>>>>>>>>> Testing Vector_swap_remove\n");
+
+        //Valid Cases
+        fprintf(stderr, "Valid Cases --------\n");
+        vec = Vector_new(0);
+        for (i = 0; i < 5; i++)
+                Vector_append(vec, Vector_int(i));
+
+        Vector_swap_remove(vec, 1);
+        assert(Vector_length(vec) == 4);
+        assert(Vector_toint(Vector_get(vec, 1)) == 4); //last moved in
+        assert(Vector_toint(Vector_get(vec, 2)) == 2);
+
+        //Edge Cases
+        fprintf(stderr, "Edge Cases ---------\n");
+        Vector_swap_remove(vec, 3); //last element
+        assert(Vector_length(vec) == 3);
+        assert(Vector_toint(Vector_last(vec)) == 2);
+        Vector_swap_remove(vec, 0);
+        Vector_swap_remove(vec, 0);
+        Vector_swap_remove(vec, 0);
+        assert(Vector_length(vec) == 0);
+        Vector_free(&vec);
+        //Vector_swap_remove(vec, 0); //expected assertion
+
+        fprintf(stderr, ">>>>>>>>>> Tests Passed.\n\n");
+}
+
+void test_vector_compact(void)
+{
+        Arena_T arena;
+        Vector_T vec;
+        intptr_t value;
+        int length = 1000;
+        int removed;
+        int i;
+
+        fprintf(stderr, ">>>>>>>>>>>>>>>>>>>> Testing Vector_compact\n");
+
+        //Valid Cases
+        fprintf(stderr, "Valid Cases --------\n");
+        vec = Vector_new(0);
+        for (i = 0; i < length; i++)
+                Vector_append(vec, Vector_int(i));
+
+        for (i = 0; i < length; i += 3)
+                Vector_mark_removed(vec, i);
+        for (i = 128; i < 320; i++) //whole words of marks
+                Vector_mark_removed(vec, i);
+        Vector_mark_removed(vec, 5);
+        Vector_mark_removed(vec, 5); //marking twice counts once
+        assert(Vector_is_removed(vec, 5));
+        assert(!Vector_is_removed(vec, 7));
+        assert(Vector_length(vec) == length); //still in place
+
+        removed = Vector_compact(vec);
+        assert(removed == 334 + 128 + 1);
+        assert(Vector_length(vec) == length - 463);
+        for (i = 1; i < Vector_length(vec); i++)
+                assert(Vector_toint(Vector_get(vec, i - 1)) <
+                       Vector_toint(Vector_get(vec, i)));
+        for (i = 0; i < Vector_length(vec); i++) {
+                value = Vector_toint(Vector_get(vec, i));
+                assert(value % 3 != 0 && value != 5);
+                assert(value < 128 || value >= 320);
+                assert(!Vector_is_removed(vec, i)); //marks cleared
+        }
+        fprintf(stderr, "%d survivors\n", Vector_length(vec));
+
+        //Edge Cases
+        fprintf(stderr, "Edge Cases ---------\n");
+        removed = Vector_compact(vec);
+        assert(removed == 0);
+        Vector_mark_removed(vec, Vector_length(vec) - 1);
+        removed = Vector_compact(vec);
+        assert(removed == 1);
+        Vector_free(&vec);
+
+        arena = Arena_new(0, false);
+        vec = Vector_new_arena(0, arena);
+        for (i = 0; i < 100; i++)
+                Vector_append(vec, Vector_int(i));
+        for (i = 0; i < 100; i++)
+                Vector_mark_removed(vec, i);
+        removed = Vector_compact(vec);
+        assert(removed == 100);
+        assert(Vector_length(vec) == 0);
+        (void) value, (void) removed;
+        Arena_free(&arena);
+
+        fprintf(stderr, ">>>>>>>>>> Tests Passed.\n\n");
+}
+
+void test_vector_cache(void)
+{
+        Arena_T arena;
+        Vector_T vecs[10];
+        Vector_T vec;
+        void **data;
+        size_t slot = sizeof(void *);
+        int i;
+
+        fprintf(stderr, ">>>>>>>>>>>>>>>>>>>> Testing Vector_cache\n");
+
+        //Valid Cases
+        fprintf(stderr, "Valid Cases --------\n");
+        Vector_cache_enable(4);
+        assert(Vector_cache_bytes() == 0);
+
+        vec = Vector_new(10); //rounded up to 15 slots
+        data = Vector_data(vec);
+        Vector_free(&vec);
+        assert(Vector_cache_bytes() == 15 * slot);
+
+        vec = Vector_new(12); //same class: reuses the array
+        assert(Vector_data(vec) == data);
+        assert(Vector_cache_bytes() == 0);
+        for (i = 0; i < 20; i++)
+                Vector_append(vec, Vector_int(i));
+        assert(Vector_cache_bytes() == 15 * slot); //outgrown array kept
+        for (i = 0; i < 20; i++)
+                assert(Vector_toint(Vector_get(vec, i)) == i);
+        Vector_free(&vec);
+        assert(Vector_cache_bytes() == (15 + 31) * slot);
+
+        for (i = 0; i < 10; i++)
+                vecs[i] = Vector_new(100);
+        for (i = 0; i < 10; i++)
+                Vector_free(&vecs[i]);
+        assert(Vector_cache_bytes() == (15 + 31 + 4 * 127) * slot);
+        fprintf(stderr, "cached: %lu bytes\n",
+                (unsigned long) Vector_cache_bytes());
+
+        Vector_cache_trim(1);
+        assert(Vector_cache_bytes() == (15 + 31 + 127) * slot);
+
+        //Edge Cases
+        fprintf(stderr, "Edge Cases ---------\n");
+        arena = Arena_new(0, false); //Arena Vectors bypass the cache
+        vec = Vector_new_arena(10, arena);
+        for (i = 0; i < 100; i++)
+                Vector_append(vec, Vector_int(i));
+        Vector_free(&vec);
+        Arena_free(&arena);
+        assert(Vector_cache_bytes() == (15 + 31 + 127) * slot);
+
+        vec = Vector_new(0); //empty Vectors are never cached
+        Vector_free(&vec);
+        Vector_cache_enable(0);
+        assert(Vector_cache_bytes() == 0);
+        vec = Vector_new(10); //cache off: not rounded, not kept
+        Vector_free(&vec);
+        assert(Vector_cache_bytes() == 0);
+        Vector_cache_free();
+        (void) data, (void) slot;
+        //Vector_cache_enable(-1); //expected assertion
+
+        fprintf(stderr, ">>>>>>>>>> Tests Passed.\n\n");
+}
+
+size_t record_length(void *elem, void *cl)
+{
+        (void) elem;
+        return *(size_t *) cl;
+}
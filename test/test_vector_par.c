@@ -0,0 +1,186 @@
+/*
+ *      filename:       test_vector_par.c
+ *      author:         @keiferchiang
+ *      date:           18 Oct 2026
+ *      version:        0.0.1
+ *
+ *      description:    Unit tests for the parallel Vector functions
+ */
+
+#include "vector_par.h"
+
+/*-------------------------------------
+ * Constants
+ -------------------------------------*/
+#define LENGTH          1000003
+
+/*-------------------------------------
+ * Function Prototypes
+ -------------------------------------*/
+void test_vector_scan(int nthreads);
+void test_vector_partition(int nthreads);
+void test_vector_filter(int nthreads);
+
+bool is_multiple(void *elem, void *cl);
+
+/*-------------------------------------
+ * Main
+ -------------------------------------*/
+int main(int argc, char *argv[]) {
+        int threads[] = { 1, 4, 0 };
+        unsigned i;
+
+        (void) argc, (void) argv;
+
+        fprintf(stderr, "\n"); //formatting
+
+        //Unit Tests
+        for (i = 0; i < sizeof(threads) / sizeof(threads[0]); i++) {
+                test_vector_scan(threads[i]);
+                test_vector_partition(threads[i]);
+                test_vector_filter(threads[i]);
+        }
+
+        return 0;
+}
+
+/*-------------------------------------
+ * Function Definitions
+ -------------------------------------*/
+void test_vector_scan(int nthreads)
+{
+        Vector_T vec;
+        intptr_t total;
+        intptr_t sum;
+        int i;
+
+        fprintf(stderr, ">>>>>>>>>>>>>>>>>>>> Testing Vector_scan"
+                " (threads: %d)\n", nthreads);
+
+        //Valid Cases
+        fprintf(stderr, "Valid Cases --------\n");
+        vec = Vector_new(0);
+        for (i = 0; i < LENGTH; i++)
+                Vector_append(vec, Vector_int(i % 10 - 3));
+
+        total = Vector_scan(vec, true, nthreads);
+        for (i = 0, sum = 0; i < LENGTH; i++) {
+                sum += i % 10 - 3;
+                assert(Vector_toint(Vector_get(vec, i)) == sum);
+        }
+        assert(total == sum);
+        fprintf(stderr, "inclusive total: %ld\n", (long) total);
+
+        for (i = 0; i < LENGTH; i++)
+                Vector_set(vec, Vector_int(1), i);
+        total = Vector_scan(vec, false, nthreads);
+        for (i = 0; i < LENGTH; i++)
+                assert(Vector_toint(Vector_get(vec, i)) == i);
+        assert(total == LENGTH);
+        fprintf(stderr, "exclusive total: %ld\n", (long) total);
+
+        //Edge Cases
+        fprintf(stderr, "Edge Cases ---------\n");
+        Vector_free(&vec);
+        vec = Vector_new(0);
+        total = Vector_scan(vec, true, nthreads);
+        assert(total == 0);
+        Vector_append(vec, Vector_int(-7));
+        total = Vector_scan(vec, false, nthreads);
+        assert(total == -7);
+        assert(Vector_toint(Vector_get(vec, 0)) == 0);
+        Vector_free(&vec);
+        //Vector_scan(NULL, true, nthreads); //expected assertion
+
+        fprintf(stderr, ">>>>>>>>>> Tests Passed.\n\n");
+}
+
+void test_vector_partition(int nthreads)
+{
+        Vector_T vec;
+        intptr_t three = 3;
+        intptr_t prev;
+        intptr_t value;
+        int ntrue;
+        int i;
+
+        fprintf(stderr, ">>>>>>>>>>>>>>>>>>>> Testing Vector_partition"
+                " (threads: %d)\n", nthreads);
+
+        //Valid Cases
+        fprintf(stderr, "Valid Cases --------\n");
+        vec = Vector_new(0);
+        for (i = 0; i < LENGTH; i++)
+                Vector_append(vec, Vector_int(i));
+
+        ntrue = Vector_partition(vec, is_multiple, &three, nthreads);
+        fprintf(stderr, "multiples of 3: %d\n", ntrue);
+        assert(ntrue == (LENGTH + 2) / 3);
+        assert(Vector_length(vec) == LENGTH);
+
+        prev = -1;
+        for (i = 0; i < LENGTH; i++) {
+                value = Vector_toint(Vector_get(vec, i));
+                assert((value % 3 == 0) == (i < ntrue));
+                if (i == ntrue)
+                        prev = -1;
+                assert(value > prev); //stable within each side
+                prev = value;
+        }
+
+        //Edge Cases
+        fprintf(stderr, "Edge Cases ---------\n");
+        three = 1;
+        ntrue = Vector_partition(vec, is_multiple, &three, nthreads);
+        assert(ntrue == LENGTH);
+        Vector_free(&vec);
+        vec = Vector_new(0);
+        ntrue = Vector_partition(vec, is_multiple, &three, nthreads);
+        assert(ntrue == 0);
+        (void) prev;
+        Vector_free(&vec);
+
+        fprintf(stderr, ">>>>>>>>>> Tests Passed.\n\n");
+}
+
+void test_vector_filter(int nthreads)
+{
+        Vector_T vec, out;
+        intptr_t seven = 7;
+        int i;
+
+        fprintf(stderr, ">>>>>>>>>>>>>>>>>>>> Testing Vector_filter"
+                " (threads: %d)\n", nthreads);
+
+        //Valid Cases
+        fprintf(stderr, "Valid Cases --------\n");
+        vec = Vector_new(0);
+        for (i = 0; i < LENGTH; i++)
+                Vector_append(vec, Vector_int(i));
+
+        out = Vector_filter(vec, is_multiple, &seven, nthreads);
+        fprintf(stderr, "multiples of 7: %d\n", Vector_length(out));
+        assert(Vector_length(out) == (LENGTH + 6) / 7);
+        for (i = 0; i < Vector_length(out); i++)
+                assert(Vector_toint(Vector_get(out, i)) == 7 * i);
+        assert(Vector_length(vec) == LENGTH);
+        assert(Vector_toint(Vector_get(vec, 1)) == 1); //source untouched
+        Vector_free(&out);
+
+        //Edge Cases
+        fprintf(stderr, "Edge Cases ---------\n");
+        seven = LENGTH + 1;
+        out = Vector_filter(vec, is_multiple, &seven, nthreads);
+        assert(Vector_length(out) == 1); //only 0
+        Vector_append(out, Vector_int(5)); //result is a regular Vector
+        assert(Vector_length(out) == 2);
+        Vector_free(&out);
+        Vector_free(&vec);
+
+        fprintf(stderr, ">>>>>>>>>> Tests Passed.\n\n");
+}
+
+bool is_multiple(void *elem, void *cl)
+{
+        return Vector_toint(elem) % *(intptr_t *) cl == 0;
+}
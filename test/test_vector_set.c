@@ -0,0 +1,447 @@
+/*
+ *      filename:       test_vector_set.c
+ *      author:         @keiferchiang
+ *      date:           18 Oct 2026
+ *      version:        0.0.1
+ *
+ *      description:    Unit tests for the Vector set functions
+ */
+
+#include "vector_set.h"
+
+/*-------------------------------------
+ * Constants
+ -------------------------------------*/
+#define LENGTH          200003
+
+/*-------------------------------------
+ * Representation
+ -------------------------------------*/
+typedef struct test {
+        unsigned id;
+        int order;
+} *Test_T;
+
+/*-------------------------------------
+ * Function Prototypes
+ -------------------------------------*/
+void test_vector_unique(void);
+void test_vector_dedup(void);
+void test_vector_dedup_par(int nthreads);
+void test_vector_set_ops(int na, int nb);
+void test_vector_set_cmp(void);
+
+Vector_T random_set(int n, int universe, unsigned *state,
+                    unsigned char *member);
+void check_set(Vector_T set, unsigned char *ma, unsigned char *mb,
+               int universe, bool in_a, bool in_b, bool in_both);
+int cmp_id(void *a, void *b, void *cl);
+bool eq_id(void *a, void *b, void *cl);
+uint64_t hash_id(void *elem, void *cl);
+uint64_t key_id(void *elem, void *cl);
+unsigned next_rand(unsigned *state);
+
+/*-------------------------------------
+ * Main
+ -------------------------------------*/
+int main(int argc, char *argv[]) {
+        (void) argc, (void) argv;
+
+        fprintf(stderr, "\n"); //formatting
+
+        //Unit Tests
+        test_vector_unique();
+        test_vector_dedup();
+        test_vector_dedup_par(1);
+        test_vector_dedup_par(4);
+        test_vector_set_ops(LENGTH / 2, LENGTH / 3); //balanced
+        test_vector_set_ops(LENGTH / 2, 300); //skewed
+        test_vector_set_ops(7, LENGTH / 2);
+        test_vector_set_cmp();
+
+        return 0;
+}
+
+/*-------------------------------------
+ * Function Definitions
+ -------------------------------------*/
+void test_vector_unique(void)
+{
+        struct test tests[6] = { { 1, 0 }, { 1, 1 }, { 2, 2 },
+                                 { 1, 3 }, { 1, 4 }, { 3, 5 } };
+        Vector_T vec;
+        int removed;
+        int i;
+
+        fprintf(stderr, ">>>>>>>>>>>>>>>>>>>> Testing Vector_unique\n");
+
+        //Valid Cases
+        fprintf(stderr, "Valid Cases --------\n");
+        vec = Vector_new(0);
+        for (i = 0; i < LENGTH; i++)
+                Vector_append(vec, Vector_int(i / 3)); //runs of three
+
+        removed = Vector_unique(vec, NULL, NULL);
+        assert(removed == LENGTH - (LENGTH + 2) / 3);
+        assert(Vector_length(vec) == (LENGTH + 2) / 3);
+        for (i = 0; i < Vector_length(vec); i++)
+                assert(Vector_toint(Vector_get(vec, i)) == i);
+        fprintf(stderr, "%d runs left\n", Vector_length(vec));
+        Vector_free(&vec);
+
+        vec = Vector_new(0);
+        for (i = 0; i < 6; i++)
+                Vector_append(vec, &tests[i]);
+        removed = Vector_unique(vec, eq_id, NULL);
+        assert(removed == 2);
+        assert(Vector_length(vec) == 4);
+        assert(((Test_T) Vector_get(vec, 0))->order == 0); //first kept
+        assert(((Test_T) Vector_get(vec, 2))->order == 3); //not adjacent
+        assert(((Test_T) Vector_get(vec, 3))->order == 5);
+
+        //Edge Cases
+        fprintf(stderr, "Edge Cases ---------\n");
+        Vector_resize(vec, 0);
+        removed = Vector_unique(vec, eq_id, NULL);
+        assert(removed == 0);
+        Vector_append(vec, &tests[0]);
+        removed = Vector_unique(vec, eq_id, NULL);
+        assert(removed == 0);
+        assert(Vector_length(vec) == 1);
+        (void) removed;
+        Vector_free(&vec);
+        //Vector_unique(NULL, NULL, NULL); //expected assertion
+
+        fprintf(stderr, ">>>>>>>>>> Tests Passed.\n\n");
+}
+
+void test_vector_dedup(void)
+{
+        Vector_T vec;
+        Test_T tests;
+        Test_T prev, curr;
+        unsigned char *seen;
+        unsigned state = 1;
+        int distinct = 0;
+        int removed;
+        int i;
+
+        fprintf(stderr, ">>>>>>>>>>>>>>>>>>>> Testing Vector_dedup\n");
+
+        //Valid Cases
+        fprintf(stderr, "Valid Cases --------\n");
+        tests = malloc(LENGTH * sizeof(struct test));
+        seen = calloc(LENGTH, 1);
+        assert(tests != NULL && seen != NULL);
+
+        vec = Vector_new(0);
+        for (i = 0; i < LENGTH; i++) {
+                tests[i].id = next_rand(&state) % LENGTH; //~37% duplicates
+                tests[i].order = i;
+                distinct += !seen[tests[i].id];
+                seen[tests[i].id] = 1;
+                Vector_append(vec, &tests[i]);
+        }
+
+        removed = Vector_dedup(vec, hash_id, eq_id, NULL);
+        assert(removed == LENGTH - distinct);
+        assert(Vector_length(vec) == distinct);
+        memset(seen, 0, LENGTH);
+        for (i = 0; i < distinct; i++) {
+                curr = Vector_get(vec, i);
+                assert(!seen[curr->id]);
+                seen[curr->id] = 1;
+                if (i > 0) {
+                        prev = Vector_get(vec, i - 1);
+                        assert(prev->order < curr->order); //order kept
+                }
+        }
+        fprintf(stderr, "%d distinct of %d\n", distinct, LENGTH);
+        Vector_free(&vec);
+
+        vec = Vector_new(0);
+        for (i = 0; i < LENGTH; i++)
+                Vector_append(vec, Vector_int(i % 1000 - 500));
+        removed = Vector_dedup(vec, NULL, NULL, NULL);
+        assert(removed == LENGTH - 1000);
+        for (i = 0; i < 1000; i++)
+                assert(Vector_toint(Vector_get(vec, i)) == i - 500);
+
+        //Edge Cases
+        fprintf(stderr, "Edge Cases ---------\n");
+        removed = Vector_dedup(vec, NULL, NULL, NULL);
+        assert(removed == 0);
+        Vector_resize(vec, 1);
+        removed = Vector_dedup(vec, NULL, NULL, NULL);
+        assert(removed == 0);
+        (void) prev, (void) removed;
+        Vector_free(&vec);
+        free(seen);
+        free(tests);
+
+        fprintf(stderr, ">>>>>>>>>> Tests Passed.\n\n");
+}
+
+void test_vector_dedup_par(int nthreads)
+{
+        Vector_T vec;
+        Test_T tests;
+        Test_T prev, curr;
+        int *first;
+        unsigned state = 9;
+        int removed;
+        int i;
+
+        fprintf(stderr, ">>>>>>>>>>>>>>>>>>>> Testing Vector_dedup_par"
+                " (threads: %d)\n", nthreads);
+
+        //Valid Cases
+        fprintf(stderr, "Valid Cases --------\n");
+        tests = malloc(LENGTH * sizeof(struct test));
+        first = malloc(LENGTH / 2 * sizeof(int));
+        assert(tests != NULL && first != NULL);
+
+        vec = Vector_new(0);
+        for (i = 0; i < LENGTH / 2; i++)
+                first[i] = -1;
+        for (i = 0; i < LENGTH; i++) {
+                tests[i].id = next_rand(&state) % (LENGTH / 2);
+                tests[i].order = i;
+                if (first[tests[i].id] < 0)
+                        first[tests[i].id] = i;
+                Vector_append(vec, &tests[i]);
+        }
+
+        Vector_dedup_par(vec, key_id, NULL, nthreads);
+        for (i = 0; i < Vector_length(vec); i++) {
+                curr = Vector_get(vec, i);
+                assert(curr->order == first[curr->id]); //first kept
+                if (i > 0) {
+                        prev = Vector_get(vec, i - 1);
+                        assert(prev->id < curr->id);
+                }
+        }
+        fprintf(stderr, "%d distinct of %d\n", Vector_length(vec), LENGTH);
+        Vector_free(&vec);
+
+        vec = Vector_new(0);
+        for (i = 0; i < LENGTH; i++)
+                Vector_append(vec, Vector_int(-(i % 777)));
+        removed = Vector_dedup_par(vec, NULL, NULL, nthreads);
+        assert(removed == LENGTH - 777);
+        for (i = 0; i < 777; i++)
+                assert(Vector_toint(Vector_get(vec, i)) == i - 776);
+
+        //Edge Cases
+        fprintf(stderr, "Edge Cases ---------\n");
+        for (i = 0; i < Vector_length(vec); i++)
+                Vector_set(vec, Vector_int(0), i);
+        removed = Vector_dedup_par(vec, NULL, NULL, nthreads);
+        assert(removed == 776);
+        assert(Vector_length(vec) == 1);
+        (void) prev, (void) curr, (void) removed;
+        Vector_free(&vec);
+        free(first);
+        free(tests);
+
+        fprintf(stderr, ">>>>>>>>>> Tests Passed.\n\n");
+}
+
+void test_vector_set_ops(int na, int nb)
+{
+        unsigned char *ma, *mb;
+        Vector_T a, b, out;
+        unsigned state = 17;
+        int universe = LENGTH;
+
+        fprintf(stderr, ">>>>>>>>>>>>>>>>>>>> Testing sorted set operations"
+                " (%d, %d)\n", na, nb);
+
+        //Valid Cases
+        fprintf(stderr, "Valid Cases --------\n");
+        ma = calloc(universe, 1);
+        mb = calloc(universe, 1);
+        assert(ma != NULL && mb != NULL);
+        a = random_set(na, universe, &state, ma);
+        b = random_set(nb, universe, &state, mb);
+
+        out = Vector_union(a, b, NULL, NULL);
+        check_set(out, ma, mb, universe, true, true, true);
+        fprintf(stderr, "union: %d\n", Vector_length(out));
+        Vector_free(&out);
+
+        out = Vector_intersect(a, b, NULL, NULL);
+        check_set(out, ma, mb, universe, false, false, true);
+        fprintf(stderr, "intersection: %d\n", Vector_length(out));
+        Vector_free(&out);
+        out = Vector_intersect(b, a, NULL, NULL);
+        check_set(out, mb, ma, universe, false, false, true);
+        Vector_free(&out);
+
+        out = Vector_difference(a, b, NULL, NULL);
+        check_set(out, ma, mb, universe, true, false, false);
+        fprintf(stderr, "difference: %d\n", Vector_length(out));
+        Vector_free(&out);
+        out = Vector_difference(b, a, NULL, NULL);
+        check_set(out, mb, ma, universe, true, false, false);
+        Vector_free(&out);
+
+        out = Vector_symdiff(a, b, NULL, NULL);
+        check_set(out, ma, mb, universe, true, true, false);
+        fprintf(stderr, "symmetric difference: %d\n", Vector_length(out));
+        Vector_free(&out);
+
+        //Edge Cases
+        fprintf(stderr, "Edge Cases ---------\n");
+        out = Vector_intersect(a, a, NULL, NULL);
+        assert(Vector_length(out) == Vector_length(a));
+        Vector_free(&out);
+        out = Vector_difference(a, a, NULL, NULL);
+        assert(Vector_length(out) == 0);
+        Vector_free(&out);
+        Vector_resize(b, 0);
+        out = Vector_union(a, b, NULL, NULL);
+        assert(Vector_length(out) == Vector_length(a));
+        Vector_free(&out);
+        out = Vector_intersect(b, a, NULL, NULL);
+        assert(Vector_length(out) == 0);
+        Vector_free(&out);
+
+        Vector_free(&a);
+        Vector_free(&b);
+        free(ma);
+        free(mb);
+
+        fprintf(stderr, ">>>>>>>>>> Tests Passed.\n\n");
+}
+
+void test_vector_set_cmp(void)
+{
+        struct test xs[5] = { { 1, 0 }, { 3, 1 }, { 5, 2 }, { 7, 3 },
+                              { 9, 4 } };
+        struct test ys[3] = { { 3, 10 }, { 4, 11 }, { 9, 12 } };
+        Vector_T a, b, out;
+        int i;
+
+        fprintf(stderr, ">>>>>>>>>>>>>>>>>>>> Testing sorted set operations"
+                " with cmp\n");
+
+        //Valid Cases
+        fprintf(stderr, "Valid Cases --------\n");
+        a = Vector_new(0);
+        b = Vector_new(0);
+        for (i = 0; i < 5; i++)
+                Vector_append(a, &xs[i]);
+        for (i = 0; i < 3; i++)
+                Vector_append(b, &ys[i]);
+
+        out = Vector_intersect(a, b, cmp_id, NULL);
+        assert(Vector_length(out) == 2);
+        assert(((Test_T) Vector_get(out, 0))->order == 1); //a's copy
+        assert(((Test_T) Vector_get(out, 1))->order == 4);
+        Vector_free(&out);
+
+        out = Vector_union(a, b, cmp_id, NULL);
+        assert(Vector_length(out) == 6);
+        assert(((Test_T) Vector_get(out, 2))->id == 4);
+        Vector_free(&out);
+
+        out = Vector_symdiff(a, b, cmp_id, NULL);
+        assert(Vector_length(out) == 4);
+        assert(((Test_T) Vector_get(out, 0))->id == 1);
+        assert(((Test_T) Vector_get(out, 3))->id == 7);
+        Vector_free(&out);
+
+        //Edge Cases
+        fprintf(stderr, "Edge Cases ---------\n");
+        out = Vector_difference(b, a, cmp_id, NULL);
+        assert(Vector_length(out) == 1);
+        assert(((Test_T) Vector_get(out, 0))->id == 4);
+        Vector_free(&out);
+        Vector_free(&a);
+        Vector_free(&b);
+        //Vector_union(NULL, NULL, NULL, NULL); //expected assertion
+
+        fprintf(stderr, ">>>>>>>>>> Tests Passed.\n\n");
+}
+
+/*
+ * Returns a sorted value set of up to n elements drawn from
+ * [0, universe), marking its members
+ */
+Vector_T random_set(int n, int universe, unsigned *state,
+                    unsigned char *member)
+{
+        Vector_T set;
+        int i;
+
+        set = Vector_new(n);
+        for (i = 0; i < n; i++)
+                Vector_append(set, Vector_int(next_rand(state) % universe));
+        Vector_dedup_par(set, NULL, NULL, 1);
+
+        for (i = 0; i < Vector_length(set); i++)
+                member[Vector_toint(Vector_get(set, i))] = 1;
+
+        return set;
+}
+
+/*
+ * Asserts set is sorted and holds exactly the values in only a,
+ * only b or both, as selected
+ */
+void check_set(Vector_T set, unsigned char *ma, unsigned char *mb,
+               int universe, bool in_a, bool in_b, bool in_both)
+{
+        intptr_t value;
+        int n = 0;
+        int v;
+
+        for (v = 0; v < universe; v++) {
+                if (!((ma[v] && mb[v] && in_both) ||
+                      (ma[v] && !mb[v] && in_a) ||
+                      (!ma[v] && mb[v] && in_b)))
+                        continue;
+
+                assert(n < Vector_length(set));
+                value = Vector_toint(Vector_get(set, n++));
+                assert(value == v);
+                (void) value;
+        }
+
+        assert(n == Vector_length(set));
+}
+
+int cmp_id(void *a, void *b, void *cl)
+{
+        (void) cl;
+        return (((Test_T) a)->id > ((Test_T) b)->id) -
+               (((Test_T) a)->id < ((Test_T) b)->id);
+}
+
+bool eq_id(void *a, void *b, void *cl)
+{
+        (void) cl;
+        return ((Test_T) a)->id == ((Test_T) b)->id;
+}
+
+uint64_t hash_id(void *elem, void *cl)
+{
+        (void) cl;
+        return ((Test_T) elem)->id;
+}
+
+uint64_t key_id(void *elem, void *cl)
+{
+        (void) cl;
+        return ((Test_T) elem)->id;
+}
+
+/*
+ * Small deterministic generator so runs are repeatable
+ */
+unsigned next_rand(unsigned *state)
+{
+        *state = *state * 1103515245u + 12345u;
+        return (*state >> 1) & 0x7fffffff;
+}
@@ -0,0 +1,364 @@
+/*
+ *      filename:       test_vector_sort.c
+ *      author:         @keiferchiang
+ *      date:           18 Oct 2026
+ *      version:        0.0.1
+ *
+ *      description:    Unit tests for the Vector sorting functions
+ */
+
+#include "vector_sort.h"
+
+/*-------------------------------------
+ * Constants
+ -------------------------------------*/
+#define LENGTH          200003
+
+/*-------------------------------------
+ * Representation
+ -------------------------------------*/
+typedef struct test {
+        unsigned x;
+        int y;
+        double z;
+} *Test_T;
+
+/*-------------------------------------
+ * Function Prototypes
+ -------------------------------------*/
+void test_vector_radix_ints(int nthreads);
+void test_vector_radix_keys(int nthreads);
+void test_vector_radix_floats(void);
+void test_vector_sort(void);
+void test_vector_nth_element(void);
+void test_vector_partial_sort(void);
+
+uint64_t key_x(void *elem, void *cl);
+uint64_t key_z(void *elem, void *cl);
+int cmp_int(void *a, void *b, void *cl);
+void shuffle(Vector_T vec, unsigned *state);
+unsigned next_rand(unsigned *state);
+
+/*-------------------------------------
+ * Main
+ -------------------------------------*/
+int main(int argc, char *argv[]) {
+        (void) argc, (void) argv;
+
+        fprintf(stderr, "\n"); //formatting
+
+        //Unit Tests
+        test_vector_radix_ints(1);
+        test_vector_radix_ints(4);
+        test_vector_radix_keys(1);
+        test_vector_radix_keys(4);
+        test_vector_radix_floats();
+        test_vector_sort();
+        test_vector_nth_element();
+        test_vector_partial_sort();
+
+        return 0;
+}
+
+/*-------------------------------------
+ * Function Definitions
+ -------------------------------------*/
+void test_vector_radix_ints(int nthreads)
+{
+        Vector_T vec;
+        unsigned state = 1;
+        intptr_t value;
+        int i;
+
+        fprintf(stderr, ">>>>>>>>>>>>>>>>>>>> Testing Vector_radix_sort"
+                " on values (threads: %d)\n", nthreads);
+
+        //Valid Cases
+        fprintf(stderr, "Valid Cases --------\n");
+        vec = Vector_new(0);
+        for (i = 0; i < LENGTH; i++) {
+                value = (intptr_t) next_rand(&state) - (1 << 30);
+                if (i % 5 == 0)
+                        value *= 1 << 20; //some values past 32 bits
+                Vector_append(vec, Vector_int(value));
+        }
+        Vector_append(vec, Vector_int(INTPTR_MIN));
+        Vector_append(vec, Vector_int(INTPTR_MAX));
+
+        Vector_radix_sort_par(vec, NULL, NULL, nthreads);
+        assert(Vector_length(vec) == LENGTH + 2);
+        for (i = 1; i < Vector_length(vec); i++)
+                assert(Vector_toint(Vector_get(vec, i - 1)) <=
+                       Vector_toint(Vector_get(vec, i)));
+        assert(Vector_toint(Vector_first(vec)) == INTPTR_MIN);
+        assert(Vector_toint(Vector_last(vec)) == INTPTR_MAX);
+        fprintf(stderr, "%d signed values in order\n", Vector_length(vec));
+
+        //Edge Cases
+        fprintf(stderr, "Edge Cases ---------\n");
+        Vector_radix_sort_par(vec, NULL, NULL, nthreads); //already sorted
+        for (i = 1; i < Vector_length(vec); i++)
+                assert(Vector_toint(Vector_get(vec, i - 1)) <=
+                       Vector_toint(Vector_get(vec, i)));
+        Vector_free(&vec);
+
+        vec = Vector_new(0);
+        for (i = 0; i < 1000; i++)
+                Vector_append(vec, Vector_int(42)); //every digit constant
+        Vector_radix_sort_par(vec, NULL, NULL, nthreads);
+        assert(Vector_toint(Vector_get(vec, 999)) == 42);
+        Vector_free(&vec);
+
+        vec = Vector_new(0);
+        Vector_radix_sort_par(vec, NULL, NULL, nthreads);
+        Vector_append(vec, Vector_int(-1));
+        Vector_radix_sort_par(vec, NULL, NULL, nthreads);
+        assert(Vector_toint(Vector_get(vec, 0)) == -1);
+        Vector_free(&vec);
+        //Vector_radix_sort(NULL, NULL, NULL); //expected assertion
+
+        fprintf(stderr, ">>>>>>>>>> Tests Passed.\n\n");
+}
+
+void test_vector_radix_keys(int nthreads)
+{
+        Vector_T vec;
+        Test_T tests;
+        Test_T prev, curr;
+        unsigned state = 7;
+        int i;
+
+        fprintf(stderr, ">>>>>>>>>>>>>>>>>>>> Testing Vector_radix_sort"
+                " on keys (threads: %d)\n", nthreads);
+
+        //Valid Cases
+        fprintf(stderr, "Valid Cases --------\n");
+        tests = malloc(LENGTH * sizeof(struct test));
+        assert(tests != NULL);
+
+        vec = Vector_new(0);
+        for (i = 0; i < LENGTH; i++) {
+                tests[i].x = next_rand(&state) % 1000;
+                tests[i].y = i;
+                Vector_append(vec, &tests[i]);
+        }
+
+        Vector_radix_sort_par(vec, key_x, NULL, nthreads);
+        for (i = 1; i < LENGTH; i++) {
+                prev = Vector_get(vec, i - 1);
+                curr = Vector_get(vec, i);
+                assert(prev->x <= curr->x);
+                if (prev->x == curr->x)
+                        assert(prev->y < curr->y); //stable
+        }
+        fprintf(stderr, "%d structs in order, ties stable\n", LENGTH);
+
+        Vector_free(&vec);
+        free(tests);
+
+        fprintf(stderr, ">>>>>>>>>> Tests Passed.\n\n");
+}
+
+void test_vector_radix_floats(void)
+{
+        double values[] = { 3.5, -0.25, 1e300, -1e300, 0.0, -7.0, 2.0,
+                            -0.5, 1e-300, 42.0 };
+        struct test tests[10];
+        Vector_T vec;
+        Test_T prev, curr;
+        int i;
+
+        fprintf(stderr, ">>>>>>>>>>>>>>>>>>>> Testing Vector_float_key\n");
+
+        //Valid Cases
+        fprintf(stderr, "Valid Cases --------\n");
+        vec = Vector_new(0);
+        for (i = 0; i < 10; i++) {
+                tests[i].z = values[i];
+                Vector_append(vec, &tests[i]);
+        }
+
+        Vector_radix_sort(vec, key_z, NULL);
+        for (i = 1; i < 10; i++) {
+                prev = Vector_get(vec, i - 1);
+                curr = Vector_get(vec, i);
+                assert(prev->z < curr->z);
+        }
+        fprintf(stderr, "doubles in order from %g to %g\n",
+                ((Test_T) Vector_first(vec))->z,
+                ((Test_T) Vector_last(vec))->z);
+
+        //Edge Cases
+        fprintf(stderr, "Edge Cases ---------\n");
+        assert(Vector_float_key(-1.0) < Vector_float_key(-0.5));
+        assert(Vector_float_key(-0.5) < Vector_float_key(0.0));
+        assert(Vector_int_key(-1) < Vector_int_key(0));
+        assert(Vector_int_key(INT64_MAX) == UINT64_MAX);
+        (void) prev, (void) curr;
+        Vector_free(&vec);
+
+        fprintf(stderr, ">>>>>>>>>> Tests Passed.\n\n");
+}
+
+void test_vector_sort(void)
+{
+        Vector_T vec;
+        unsigned state = 3;
+        int i;
+
+        fprintf(stderr, ">>>>>>>>>>>>>>>>>>>> Testing Vector_sort\n");
+
+        //Valid Cases
+        fprintf(stderr, "Valid Cases --------\n");
+        vec = Vector_new(0);
+        for (i = 0; i < LENGTH; i++)
+                Vector_append(vec, Vector_int(next_rand(&state) % 5000));
+
+        Vector_sort(vec, cmp_int, NULL);
+        for (i = 1; i < LENGTH; i++)
+                assert(Vector_toint(Vector_get(vec, i - 1)) <=
+                       Vector_toint(Vector_get(vec, i)));
+        fprintf(stderr, "%d values in order\n", LENGTH);
+
+        //Edge Cases
+        fprintf(stderr, "Edge Cases ---------\n");
+        for (i = 0; i < LENGTH; i++) //descending, then all equal
+                Vector_set(vec, Vector_int(LENGTH - i), i);
+        Vector_sort(vec, cmp_int, NULL);
+        for (i = 0; i < LENGTH; i++)
+                assert(Vector_toint(Vector_get(vec, i)) == i + 1);
+        for (i = 0; i < LENGTH; i++)
+                Vector_set(vec, Vector_int(9), i);
+        Vector_sort(vec, cmp_int, NULL);
+        assert(Vector_toint(Vector_last(vec)) == 9);
+        Vector_free(&vec);
+
+        vec = Vector_new(0);
+        Vector_sort(vec, cmp_int, NULL);
+        assert(Vector_length(vec) == 0);
+        Vector_free(&vec);
+
+        fprintf(stderr, ">>>>>>>>>> Tests Passed.\n\n");
+}
+
+void test_vector_nth_element(void)
+{
+        Vector_T vec;
+        unsigned state = 11;
+        intptr_t nth;
+        int ns[] = { 0, 1, LENGTH / 2, LENGTH - 2, LENGTH - 1 };
+        unsigned j;
+        int i;
+
+        fprintf(stderr, ">>>>>>>>>>>>>>>>>>>> Testing Vector_nth_element\n");
+
+        //Valid Cases
+        fprintf(stderr, "Valid Cases --------\n");
+        vec = Vector_new(0);
+        for (j = 0; j < sizeof(ns) / sizeof(ns[0]); j++) {
+                Vector_resize(vec, 0);
+                for (i = 0; i < LENGTH; i++) //a permutation of 0..n-1
+                        Vector_append(vec, Vector_int((i * 7919L) % LENGTH));
+                shuffle(vec, &state);
+
+                Vector_nth_element(vec, ns[j], cmp_int, NULL);
+                nth = Vector_toint(Vector_get(vec, ns[j]));
+                assert(nth == ns[j]);
+                for (i = 0; i < ns[j]; i++)
+                        assert(Vector_toint(Vector_get(vec, i)) < nth);
+                for (i = ns[j] + 1; i < LENGTH; i++)
+                        assert(Vector_toint(Vector_get(vec, i)) > nth);
+                fprintf(stderr, "element %d selected\n", ns[j]);
+        }
+
+        //Edge Cases
+        fprintf(stderr, "Edge Cases ---------\n");
+        for (i = 0; i < LENGTH; i++)
+                Vector_set(vec, Vector_int(i % 2), i); //heavy duplicates
+        Vector_nth_element(vec, LENGTH / 2, cmp_int, NULL); //last 0
+        assert(Vector_toint(Vector_get(vec, LENGTH / 2)) == 0);
+        Vector_nth_element(vec, LENGTH / 2 + 1, cmp_int, NULL);
+        assert(Vector_toint(Vector_get(vec, LENGTH / 2 + 1)) == 1);
+        Vector_resize(vec, 1);
+        Vector_nth_element(vec, 0, cmp_int, NULL);
+        (void) nth;
+        Vector_free(&vec);
+        //Vector_nth_element(vec, 1, cmp_int, NULL); //expected assertion
+
+        fprintf(stderr, ">>>>>>>>>> Tests Passed.\n\n");
+}
+
+void test_vector_partial_sort(void)
+{
+        Vector_T vec;
+        unsigned state = 5;
+        int i;
+
+        fprintf(stderr, ">>>>>>>>>>>>>>>>>>>> Testing Vector_partial_sort\n");
+
+        //Valid Cases
+        fprintf(stderr, "Valid Cases --------\n");
+        vec = Vector_new(0);
+        for (i = 0; i < LENGTH; i++)
+                Vector_append(vec, Vector_int(LENGTH - 1 - i));
+        shuffle(vec, &state);
+
+        Vector_partial_sort(vec, 100, cmp_int, NULL);
+        for (i = 0; i < 100; i++)
+                assert(Vector_toint(Vector_get(vec, i)) == i);
+        for (i = 100; i < LENGTH; i++)
+                assert(Vector_toint(Vector_get(vec, i)) >= 100);
+        fprintf(stderr, "smallest 100 of %d in order\n", LENGTH);
+
+        //Edge Cases
+        fprintf(stderr, "Edge Cases ---------\n");
+        Vector_partial_sort(vec, 0, cmp_int, NULL);
+        Vector_partial_sort(vec, LENGTH + 10, cmp_int, NULL); //full sort
+        for (i = 0; i < LENGTH; i++)
+                assert(Vector_toint(Vector_get(vec, i)) == i);
+        Vector_free(&vec);
+
+        fprintf(stderr, ">>>>>>>>>> Tests Passed.\n\n");
+}
+
+uint64_t key_x(void *elem, void *cl)
+{
+        (void) cl;
+        return ((Test_T) elem)->x;
+}
+
+uint64_t key_z(void *elem, void *cl)
+{
+        (void) cl;
+        return Vector_float_key(((Test_T) elem)->z);
+}
+
+int cmp_int(void *a, void *b, void *cl)
+{
+        (void) cl;
+        return (Vector_toint(a) > Vector_toint(b)) -
+               (Vector_toint(a) < Vector_toint(b));
+}
+
+void shuffle(Vector_T vec, unsigned *state)
+{
+        void **array = Vector_data(vec);
+        void *temp;
+        int i, j;
+
+        for (i = Vector_length(vec) - 1; i > 0; i--) {
+                j = next_rand(state) % (i + 1);
+                temp = array[i];
+                array[i] = array[j];
+                array[j] = temp;
+        }
+}
+
+/*
+ * Small deterministic generator so runs are repeatable
+ */
+unsigned next_rand(unsigned *state)
+{
+        *state = *state * 1103515245u + 12345u;
+        return (*state >> 1) & 0x7fffffff;
+}
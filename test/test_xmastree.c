@@ -0,0 +1,229 @@
+/*
+ *      filename:       test_xmastree.c
+ *      author:         @keiferchiang
+ *      date:           18 Oct 2026
+ *      version:        0.0.1
+ *
+ *      description:    Unit tests for the XmasTree module
+ */
+
+#include <stdint.h>
+#include <pthread.h>
+
+#include "xmastree.h"
+
+/*-------------------------------------
+ * Constants
+ -------------------------------------*/
+#define LENGTH          100003
+#define NTHREADS        8
+
+/*-------------------------------------
+ * Representation
+ -------------------------------------*/
+typedef struct worker_t {
+        XmasTree_T tree;
+        int lo;
+        int hi;
+        int popped;
+        intptr_t sum;
+} Worker_T;
+
+/*-------------------------------------
+ * Function Prototypes
+ -------------------------------------*/
+void test_xmastree_single(void);
+void test_xmastree_relaxed(void);
+void test_xmastree_threads(void);
+
+int cmp_int(void *a, void *b, void *cl);
+void *worker_main(void *arg);
+
+/*-------------------------------------
+ * Main
+ -------------------------------------*/
+int main(int argc, char *argv[]) {
+        (void) argc, (void) argv;
+
+        fprintf(stderr, "\n"); //formatting
+
+        //Unit Tests
+        test_xmastree_single();
+        test_xmastree_relaxed();
+        test_xmastree_threads();
+
+        return 0;
+}
+
+/*-------------------------------------
+ * Function Definitions
+ -------------------------------------*/
+void test_xmastree_single(void)
+{
+        XmasTree_T tree;
+        void *elem;
+        bool ok;
+        int i;
+
+        fprintf(stderr, ">>>>>>>>>>>>>>>>>>>> Testing XmasTree (1 thread)\n");
+
+        //Valid Cases
+        fprintf(stderr, "Valid Cases --------\n");
+        tree = XmasTree_new(1, cmp_int, NULL);
+        for (i = 0; i < LENGTH; i++)
+                XmasTree_push(tree, Vector_int((i * 7919L) % LENGTH));
+        assert(XmasTree_length(tree) == LENGTH);
+
+        /* two heaps: every pop sees both minima, so order is exact */
+        for (i = 0; i < LENGTH; i++) {
+                ok = XmasTree_pop(tree, &elem);
+                assert(ok && Vector_toint(elem) == i);
+        }
+        fprintf(stderr, "popped in order: %d\n", LENGTH);
+
+        //Edge Cases
+        fprintf(stderr, "Edge Cases ---------\n");
+        ok = XmasTree_pop(tree, &elem);
+        assert(!ok);
+        assert(XmasTree_length(tree) == 0);
+        XmasTree_push(tree, Vector_int(3));
+        ok = XmasTree_pop(tree, &elem);
+        assert(ok && elem == Vector_int(3));
+        (void) ok;
+        //XmasTree_pop(tree, NULL); //expected assertion
+        XmasTree_free(&tree);
+        assert(tree == NULL);
+
+        fprintf(stderr, ">>>>>>>>>> Tests Passed.\n\n");
+}
+
+void test_xmastree_relaxed(void)
+{
+        XmasTree_T tree;
+        unsigned char *seen;
+        void *elem;
+        intptr_t value;
+        long error = 0;
+        bool ok;
+        int i;
+
+        fprintf(stderr, ">>>>>>>>>>>>>>>>>>>> Testing XmasTree (relaxed)\n");
+
+        //Valid Cases
+        fprintf(stderr, "Valid Cases --------\n");
+        tree = XmasTree_new(NTHREADS, cmp_int, NULL);
+        seen = calloc(LENGTH, 1);
+        assert(seen != NULL);
+        for (i = 0; i < LENGTH; i++)
+                XmasTree_push(tree, Vector_int((i * 7919L) % LENGTH));
+
+        /* every element exactly once, each near the true minimum */
+        for (i = 0; i < LENGTH; i++) {
+                ok = XmasTree_pop(tree, &elem);
+                assert(ok);
+                value = Vector_toint(elem);
+                assert(!seen[value]);
+                seen[value] = 1;
+                error += value > i ? value - i : i - value;
+        }
+        ok = XmasTree_pop(tree, &elem);
+        assert(!ok);
+        fprintf(stderr, "mean rank error: %.2f\n", (double) error / LENGTH);
+        assert(error / LENGTH < 4 * 2 * NTHREADS);
+
+        //Edge Cases
+        fprintf(stderr, "Edge Cases ---------\n");
+        free(seen);
+        XmasTree_free(&tree);
+        tree = XmasTree_new(0, cmp_int, NULL); //one per CPU
+        ok = XmasTree_pop(tree, &elem);
+        assert(!ok);
+        (void) ok;
+        XmasTree_free(&tree);
+        //XmasTree_new(1, NULL, NULL); //expected assertion
+
+        fprintf(stderr, ">>>>>>>>>> Tests Passed.\n\n");
+}
+
+void test_xmastree_threads(void)
+{
+        XmasTree_T tree;
+        pthread_t threads[NTHREADS];
+        Worker_T workers[NTHREADS];
+        void *elem;
+        intptr_t sum = 0;
+        int popped = 0;
+        int t, err;
+
+        fprintf(stderr, ">>>>>>>>>>>>>>>>>>>> Testing XmasTree (%d threads)\n",
+                NTHREADS);
+
+        //Valid Cases
+        fprintf(stderr, "Valid Cases --------\n");
+        tree = XmasTree_new(NTHREADS, cmp_int, NULL);
+        for (t = 0; t < NTHREADS; t++) {
+                workers[t].tree = tree;
+                workers[t].lo = (int) ((long) LENGTH * t / NTHREADS);
+                workers[t].hi = (int) ((long) LENGTH * (t + 1) / NTHREADS);
+                err = pthread_create(&threads[t], NULL, worker_main,
+                                     &workers[t]);
+                assert(err == 0);
+        }
+        for (t = 0; t < NTHREADS; t++) {
+                pthread_join(threads[t], NULL);
+                popped += workers[t].popped;
+                sum += workers[t].sum;
+        }
+
+        /* a worker may stop early; whatever is left is popped here */
+        while (XmasTree_pop(tree, &elem)) {
+                popped++;
+                sum += Vector_toint(elem);
+        }
+        assert(popped == LENGTH);
+        assert(sum == (intptr_t) LENGTH * (LENGTH - 1) / 2);
+        fprintf(stderr, "popped: %d, sum: %ld\n", popped, (long) sum);
+
+        //Edge Cases
+        fprintf(stderr, "Edge Cases ---------\n");
+        (void) err;
+        assert(XmasTree_length(tree) == 0);
+        XmasTree_free(&tree);
+
+        fprintf(stderr, ">>>>>>>>>> Tests Passed.\n\n");
+}
+
+int cmp_int(void *a, void *b, void *cl)
+{
+        intptr_t x = Vector_toint(a);
+        intptr_t y = Vector_toint(b);
+
+        (void) cl;
+
+        return (x > y) - (x < y);
+}
+
+void *worker_main(void *arg)
+{
+        Worker_T *worker = arg;
+        void *elem;
+        int i;
+
+        worker->popped = 0;
+        worker->sum = 0;
+
+        /* interleave pushes and pops, then drain */
+        for (i = worker->lo; i < worker->hi; i++) {
+                XmasTree_push(worker->tree, Vector_int(i));
+                if (i % 3 == 0 && XmasTree_pop(worker->tree, &elem)) {
+                        worker->popped++;
+                        worker->sum += Vector_toint(elem);
+                }
+        }
+        while (XmasTree_pop(worker->tree, &elem)) {
+                worker->popped++;
+                worker->sum += Vector_toint(elem);
+        }
+
+        return NULL;
+}